@@ -0,0 +1,64 @@
+#!/bin/bash
+# Usage: ./cachelines.sh [--lines] [--rndn|--rndz|--rndu|--rndd] exp
+# Reports how many distinct 64-byte cache lines of tables each call of the
+# function touches, for the inputs sampled by its random_under_test().
+# With --lines, also lists the lines touched with the symbols they hold.
+
+ARGS=()
+lines=0
+while [ $# -gt 1 ]; do
+    if [ "$1" == "--lines" ]; then
+        lines=1
+    else
+        ARGS+=("$1")
+    fi
+    shift
+done
+
+f=$1
+u="$(echo src/binary*/*/$f.c)"
+
+if [ -f "$u" ]; then
+    dir="${u%/*}"
+else
+    echo "Unknown function: $f"
+    exit 2
+fi
+
+if [ "$CFLAGS" == "" ]; then
+   export CFLAGS="-O3 -march=native"
+fi
+
+cd $dir
+make -s clean
+make -s cachelines
+
+if [ $lines == 0 ]; then
+    ./cachelines "${ARGS[@]}"
+    exit
+fi
+
+# the line offsets are relative to __executable_start: map them to the
+# symbols overlapping each line
+./cachelines --lines "${ARGS[@]}" | awk -v nm="nm -n -S --defined-only ./cachelines" '
+function hex(s,  v, k) {
+  sub(/^0x/, "", s); v = 0
+  for (k = 1; k <= length(s); k++)
+    v = 16 * v + index("0123456789abcdef", tolower(substr(s, k, 1))) - 1
+  return v
+}
+BEGIN {
+  while ((nm | getline) > 0) {
+    if (NF == 4) { n++; addr[n] = hex($1); size[n] = hex($2); name[n] = $4 }
+    if ($NF == "__executable_start") start = hex($1)
+  }
+}
+$1 == "line" {
+  l = start + hex($2); s = ""
+  for (k = 1; k <= n; k++)
+    if (addr[k] < l + 64 && addr[k] + size[k] > l)
+      s = s " " name[k] (l >= addr[k] ? "+" : "") l - addr[k]
+  printf "%s %s%s\n", $2, $3, s
+  next
+}
+{ print }'
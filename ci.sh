@@ -16,21 +16,28 @@ fi
 
 # use the same order as on https://core-math.gitlabpages.inria.fr/
 FUNCTIONS_EXHAUSTIVE=(acosf acoshf acospif asinf asinhf asinpif atanf atanhf atanpif cbrtf cosf coshf cospif erff erfcf expf exp10f exp10m1f exp2f exp2m1f expm1f lgammaf logf log10f log10p1f log1pf log2f log2p1f rsqrtf sincosf sinf sinhf sinpif tanf tanhf tanpif tgammaf)
-FUNCTIONS_WORST=(acos acosh acospi asin asinh asinpi atan atan2 atan2f atan2pi atan2pif atanh atanpi cbrt cbrtl cos cosh cospi erf erfc exp expl exp10 exp10m1 exp2 exp2l exp2m1 hypot hypotf log log10 log10p1 log1p log2 log2l log2p1 pow powf powl rsqrt rsqrtl sin sincos sinh sinpi tan tanh tanpi tgamma)
+FUNCTIONS_WORST=(acos acosh acospi asin asinh asinpi atan atan2 atan2f atan2pi atan2pif atanh atanpi cbrt cbrtl cos cosh cospi erf erfc exp expl exp10 exp10m1 exp2 exp2l exp2m1 hypot hypotf log log10 log10p1 log1p log2 log2l log2p1 pow powf powl rsqrt rsqrtl sin sincos sinh sinhcosh sinpi tan tanh tanpi tgamma)
 FUNCTIONS_SPECIAL=(acos acosf acosh acospi acospif asin asinh asinpi asinpif atan atanf atan2 atan2f atan2pi atan2pif atanh atanpi atanpif cbrt cos cosh cospi cospif erf erfc erfcf exp expf exp10 exp10m1 exp2 exp2m1 exp2m1f expm1 hypot hypotf lgammaf log log10 log10p1 log1p log2 log2p1 pow powf powl rsqrt sin sinh sinpi tan tanh tanpi tanpif)
 
 echo "Reference commit is $LAST_COMMIT"
 
 check () {
     KIND="$1"
+    DIR="$(dirname src/*/*/$FUNCTION.c)"
+    # functions sharing a kernel (SHARED_OBJS in their Makefile) also
+    # depend on the kernel sources in ../support
+    SHARED="$(sed -n 's/^SHARED_OBJS *:= *//p' "$DIR/Makefile" | sed "s|\([a-z0-9_]*\)\.o|$DIR/../support/\1.[ch]|g")"
+    if [ -n "$SHARED" ]; then
+        SHARED="$SHARED $DIR/../support/*.h"
+    fi
     if [ "$FORCE" != "" ]; then
         doit=1
-    elif ! { echo "$FORCE_FUNCTIONS" | tr ' ' '\n' | grep --quiet '^'"$FUNCTION"'$'; } && git diff --quiet "$LAST_COMMIT".. -- src/*/*/$FUNCTION.c; then
+    elif ! { echo "$FORCE_FUNCTIONS" | tr ' ' '\n' | grep --quiet '^'"$FUNCTION"'$'; } && git diff --quiet "$LAST_COMMIT".. -- src/*/*/$FUNCTION.c $SHARED; then
         doit=0
     else
         doit=1
     fi
-		if [ "$doit" == "1" ] && [ "$SKIP128" == "1" ] && $CC -E src/*/*/$FUNCTION.c | grep -q  __int128; then
+		if [ "$doit" == "1" ] && [ "$SKIP128" == "1" ] && $CC -E -I "$DIR/../support" src/*/*/$FUNCTION.c | grep -q  __int128; then
         echo "__int128 support is needed for" $FUNCTION "but is not available"
         doit=0
     fi
@@ -0,0 +1,101 @@
+#!/bin/bash
+# Usage:
+# ./footprint.sh                  (all functions)
+# ./footprint.sh exp log powf     (some functions)
+# ./footprint.sh --tables exp     (also list the tables)
+#
+# Reports the cache footprint of each function, compiled with its shared
+# kernels as by its Makefile, and keeping only the parts of the kernels it
+# uses (as when linked with --gc-sections), one line per function:
+#   function text-hot text-cold rodata data lines-mean lines-max footprint
+# where the sizes are in bytes: text-hot is the code in .text, text-cold
+# the code the compiler moved to .text.unlikely (cold functions and the
+# .cold parts of the others), rodata the tables and constants, and data the
+# writable data. The last three fields are given by ./cachelines.sh: the
+# mean and max number of 64-byte lines of tables touched per call, and the
+# number of lines touched by all calls, for the inputs sampled by
+# random_under_test() (n/a for the sincos-like functions).
+# With --tables, each function line is followed by one line per table
+# (symbol of .rodata or .data), with its section and size in bytes, sorted
+# by name, and the size of the rest (constants of the compiler and unnamed
+# tables).
+# The output does not depend on the machine beyond the compiler and CFLAGS,
+# so that outputs for two releases can be compared with diff.
+
+set -e
+
+# this is to make the order of functions deterministic
+export LC_ALL=C
+
+tables=0
+if [ "$1" == "--tables" ]; then
+    tables=1
+    shift
+fi
+
+if [ "$CFLAGS" == "" ]; then
+   CFLAGS="-O3 -march=native"
+   ROUNDING_MATH="-frounding-math"
+fi
+export CFLAGS ROUNDING_MATH
+
+if [ $# -eq 0 ]; then
+    set -- $(for u in src/binary*/*/Makefile; do
+                 sed -n 's/FUNCTION_UNDER_TEST := //p' $u
+             done)
+fi
+
+echo "# function text-hot text-cold rodata data lines-mean lines-max footprint"
+for f in "$@"; do
+    u="$(echo src/binary*/*/$f.c)"
+    if [ ! -f "$u" ]; then
+        echo "Unknown function: $f" >&2
+        exit 2
+    fi
+    (
+        cd "${u%/*}"
+        shared="$(sed -n 's/SHARED_OBJS := //p' Makefile)"
+        make -s clean
+        make -s $f.o $shared
+        # the shared kernels have one section per function and table (see
+        # ../support/Makefile.univariate): as when linked with
+        # --gc-sections, only keep what the entry points of $f.o use
+        roots="$(nm -g --defined-only $f.o | awk '{ print "-u", $3 }')"
+        ld -r --gc-sections $roots -o footprint.o $f.o $shared
+        # sizes of the sections
+        sizes="$(size -A footprint.o | awk '
+            $1 ~ /^\.text\.unlikely/ { cold += $2; next }
+            $1 ~ /^\.text/ { hot += $2 }
+            $1 ~ /^\.rodata/ { rodata += $2 }
+            $1 ~ /^\.data/ { data += $2 }
+            END { printf "%d %d %d %d", hot, cold, rodata, data }')"
+        lines="n/a n/a n/a"
+        if make -s -n cachelines > /dev/null 2>&1; then
+            make -s cachelines
+            lines="$(./cachelines | awk '
+                /^lines per call:/ { mean = $5; sub(/,/, "", mean); max = $7 }
+                /^footprint:/ { fp = $2 }
+                END { print mean, max, fp }')"
+        fi
+        echo "$f $sizes $lines"
+        if [ $tables == 1 ]; then
+            # objdump -t: value flags section size name
+            named="$(objdump -t footprint.o | awk '
+                function hex(s,  v, k) {
+                  v = 0
+                  for (k = 1; k <= length(s); k++)
+                    v = 16 * v + index("0123456789abcdef", substr(s, k, 1)) - 1
+                  return v
+                }
+                { sub(/[ \t]\.hidden[ \t]/, " ") }
+                NF >= 5 && $(NF-2) ~ /^\.(rodata|data)/ && $(NF-1) !~ /^0+$/ && $NF !~ /^\./ {
+                    printf "  %s %s %d\n", $NF, $(NF-2), hex($(NF-1)) }' | sort)"
+            [ -z "$named" ] || echo "$named"
+            # the rest: constants of the compiler, and unnamed tables
+            total="$(echo "$sizes" | awk '{ print $3 + $4 }')"
+            echo "$named" | awk -v total=$total '{ s += $3 }
+                END { printf "  (other) .rodata %d\n", total - s }'
+        fi
+        make -s clean
+    )
+done
@@ -0,0 +1,104 @@
+#!/bin/bash
+# Usage:
+# ./mca.sh                          (all functions)
+# ./mca.sh exp log pow              (some functions)
+# MCA_CPUS="skylake znver3" ./mca.sh exp
+#
+# Static analysis of the fast paths with llvm-mca, which does not depend on
+# the noise of the machine. For each function and each cpu of MCA_CPUS
+# (skylake, icelake-server and znver4 by default), the function is compiled
+# with -march=cpu, its fast path is extracted (see
+# src/generic/support/mca_fastpath.awk: from the entry up to the first
+# return or call into another function, following the likely side of the
+# branches), and simulated by llvm-mca for that cpu. One line is printed
+# for each function and cpu:
+#   function cpu instructions uops rthroughput latency ratio pressure end
+# where rthroughput is the reciprocal throughput predicted by llvm-mca
+# (Block RThroughput, limited by the ports only), latency the cycles of
+# one isolated call (Total Cycles for 1 iteration), ratio = latency /
+# rthroughput, pressure the three busiest resources with their cycles per
+# call, and end what ends the fast path (ret, call xxx, ...).
+# A high ratio means a function bound by a chain of dependencies (such as a
+# Horner evaluation), which would benefit from more parallelism (such as an
+# Estrin evaluation), while a ratio close to 1 means a function bound by
+# the ports. A cpu unknown to the compiler or to llvm-mca is skipped.
+
+set -e
+
+# this is to make the order of functions deterministic
+export LC_ALL=C
+
+MCA_CPUS=${MCA_CPUS:-skylake icelake-server znver4}
+LLVM_MCA=${LLVM_MCA:-llvm-mca}
+export LLVM_MCA
+
+if [ "$CFLAGS" == "" ]; then
+   CFLAGS="-O3"
+   ROUNDING_MATH="-frounding-math"
+fi
+export CFLAGS ROUNDING_MATH
+
+if [ $# -eq 0 ]; then
+    set -- $(for u in src/binary*/*/Makefile; do
+                 sed -n 's/FUNCTION_UNDER_TEST := //p' $u
+             done)
+fi
+
+# the cpus known to the compiler and to llvm-mca
+CPUS=""
+for cpu in $MCA_CPUS; do
+    if ! echo "int x;" | ${CC:-cc} -march=$cpu -x c -S -o /dev/null - 2> /dev/null; then
+        echo "Skipping $cpu: unknown to ${CC:-cc}" >&2
+    elif echo "" | $LLVM_MCA -mcpu=$cpu 2>&1 | grep -q "not a recognized processor"; then
+        echo "Skipping $cpu: unknown to $LLVM_MCA" >&2
+    else
+        CPUS="$CPUS $cpu"
+    fi
+done
+
+echo "# function cpu instructions uops rthroughput latency ratio pressure end"
+for f in "$@"; do
+    u="$(echo src/binary*/*/$f.c)"
+    if [ ! -f "$u" ]; then
+        echo "Unknown function: $f" >&2
+        exit 2
+    fi
+    dir="${u%/*}"
+    for cpu in $CPUS; do
+        make -s -C $dir clean
+        if ! make -s -C $dir MCA_CPU=$cpu ${f}_mca.s 2> /dev/null; then
+            echo "$f $cpu failed"
+            continue
+        fi
+        s=$dir/${f}_mca.s
+        end="$(sed -n 's/^# end: //p' $s | tr ' ' :)"
+        $LLVM_MCA -mcpu=$cpu -iterations=1 $s 2> /dev/null | awk \
+            -v f=$f -v cpu=$cpu -v end=$end '
+            /^Instructions:/ { insts = $2 }
+            /^Total Cycles:/ { latency = $3 }
+            /^Total uOps:/ { uops = $3 }
+            /^Block RThroughput:/ { rthroughput = $3 }
+            /^Resources:/ { res = 1; next }
+            res && /^\[[0-9]+\]/ { name[nres++] = $3; next }
+            res { res = 0 }
+            /^Resource pressure per iteration:/ { getline; getline;
+                for (k = 1; k <= NF; k++) p[k - 1] = ($k == "-") ? 0 : $k }
+            END {
+              pressure = ""
+              for (j = 0; j < 3 && j < nres; j++) {
+                best = -1
+                for (k = 0; k < nres; k++)
+                  if (!(k in used) && (best < 0 || p[k] > p[best]))
+                    best = k
+                if (p[best] == 0)
+                  break
+                used[best] = 1
+                pressure = pressure (j ? "," : "") name[best] "=" p[best]
+              }
+              printf "%s %s %d %d %s %s %.2f %s %s\n", f, cpu, insts, uops,
+                     rthroughput, latency, latency / rthroughput,
+                     pressure == "" ? "-" : pressure, end
+            }'
+    done
+    make -s -C $dir clean
+done
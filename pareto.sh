@@ -0,0 +1,70 @@
+#!/bin/bash
+# Usage:
+# ./pareto.sh                       (all functions)
+# ./pareto.sh exp log powf          (some functions)
+# ./pareto.sh --csv exp log         (one CSV file for all functions)
+# PARETO_LIBS="/usr/lib/libopenlibm.so ./libsleef.so" ./pareto.sh exp
+#
+# Accuracy versus speed of core-math and of other libms. For each function
+# (binary32 and binary64, except the sincos-like ones), ./accuracy is built
+# with MPFR (see src/generic/support/accuracy.c) and run on PARETO_COUNT
+# inputs (1000000 by default) sampled by random_under_test(), or by
+# PARETO_DIST (see perf_dist.h): it prints, for core-math, the libm given by
+# LIBM (the libc by default) and each library of PARETO_LIBS, the
+# cycles/call, the maximal and mean error in ulps, the fraction of
+# incorrectly rounded results, and whether the implementation is on the
+# Pareto frontier of speed and maximal error. PARETO_ARGS is passed to
+# ./accuracy (for example --rndz).
+
+set -e
+
+# this is to make the order of functions deterministic
+export LC_ALL=C
+
+csv=0
+if [ "$1" == "--csv" ]; then
+    csv=1
+    shift
+fi
+
+if [ "$CFLAGS" == "" ]; then
+   CFLAGS="-O3 -march=native"
+   ROUNDING_MATH="-frounding-math"
+fi
+export CFLAGS ROUNDING_MATH
+
+if [ $# -eq 0 ]; then
+    set -- $(for u in src/binary32/*/Makefile src/binary64/*/Makefile; do
+                 sed -n 's/FUNCTION_UNDER_TEST := //p' $u
+             done)
+fi
+
+args="--count ${PARETO_COUNT:-1000000} $PARETO_ARGS"
+for lib in $PARETO_LIBS; do
+    # dlopen needs a path to find a library outside the search path
+    case $lib in
+        */*) args="$args --lib $(realpath $lib)" ;;
+        *) args="$args --lib $lib" ;;
+    esac
+done
+[ $csv == 0 ] || args="$args --csv"
+
+[ $csv == 0 ] || echo "function,impl,cycles,max_ulps,mean_ulps,incorrect,pareto"
+for f in "$@"; do
+    u="$(echo src/binary*/*/$f.c)"
+    if [ ! -f "$u" ]; then
+        echo "Unknown function: $f" >&2
+        exit 2
+    fi
+    (
+        cd "${u%/*}"
+        if ! make -s -n accuracy > /dev/null 2>&1; then
+            echo "Skipping $f: no accuracy target" >&2
+            exit 0
+        fi
+        make -s clean
+        make -s accuracy
+        $CORE_MATH_LAUNCHER ./accuracy $args ${PARETO_DIST:+--dist "$PARETO_DIST"}
+        make -s clean
+    )
+done
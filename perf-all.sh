@@ -3,6 +3,10 @@
 # ./perf-all.sh
 # CORE_MATH_QUIET=1 ./perf-all.sh
 # CORE_MATH_SIMPLE_STAT=1 ./perf-all.sh (old stat mechanism)
+# CORE_MATH_RESULTS=results.csv ./perf-all.sh (also record all the trials
+#   with the settings, to be compared with ./perf-compare.sh)
+# CORE_MATH_PERF_MODE=counters ./perf-all.sh (hardware counters, one column
+#   per counter for core-math, then for the libc, then for $LIBM if set)
 
 # this is to make the order of functions deterministic
 export LC_ALL=C
@@ -13,6 +17,19 @@ if [ -z "$CORE_MATH_QUIET" ]; then
     $CORE_MATH_LAUNCHER src/generic/support/glibc_version >&2
 fi
 
+if [ "$CORE_MATH_PERF_MODE" = counters ]; then
+    # the counters printed by perf --counters (see perf_events.h)
+    c="cycles instructions branch-misses L1I-misses L1D-misses LLC-misses uops"
+    c="$c fp-assists"
+    c="$c IPC retiring bad-spec fe-bound be-bound"
+    pgo=""
+    [ -n "$CORE_MATH_PERF_PGO" ] && pgo="$(echo $c | sed 's/[^ ]*/pgo-&/g')"
+    [ "$CORE_MATH_PERF_PGO" = bolt ] && pgo="$pgo $(echo $c | sed 's/[^ ]*/bolt-&/g')"
+    libm=""
+    [ -n "$LIBM" ] && libm="$(echo $c | sed "s/[^ ]*/$(basename "$LIBM" .a)-&/g")"
+    echo "# function $c $(echo $c | sed 's/[^ ]*/libc-&/g') $pgo $libm"
+fi
+
 for u in src/binary*/*/Makefile; do
     f="$(sed -n 's/FUNCTION_UNDER_TEST := //p' $u)"
     echo -n "$f "
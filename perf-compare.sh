@@ -0,0 +1,9 @@
+#!/bin/bash
+# Usage: ./perf-compare.sh [--all] [--alpha a] [--threshold t] old.csv new.csv
+# Compares two results files of perf.sh/perf-all.sh (CORE_MATH_RESULTS),
+# and prints the significant regressions and improvements, see
+# src/generic/support/perf_compare.c. The exit status is 1 if there is a
+# regression.
+
+make -s -C src/generic/support perf_compare || exit 2
+src/generic/support/perf_compare "$@"
@@ -0,0 +1,59 @@
+#!/bin/bash
+# Usage:
+# ./perf-mix.sh --mix exp:40,log:30,sin:10,cos:10,pow:10 [--order random|rr]
+# ./perf-mix.sh --mix-file trace.txt [--order random|rr|trace]
+# ./perf-mix.sh --trace /tmp/trace.1234.1234  (see trace_preload.c)
+# (other options: --count N, --repeat M, see src/generic/support/perf_mix.c)
+#
+# Builds perf-mix, which links all the binary32 and binary64 functions
+# (each compiled by its own Makefile, with its shared kernels), and runs it
+# with the given options: it prints the cycles/call of the mix, hardware
+# counters and the cycles attributed to each function, for core-math and
+# for the libm.
+
+set -e
+
+if [ "$CFLAGS" == "" ]; then
+   CFLAGS="-O3 -march=native"
+   ROUNDING_MATH="-frounding-math"
+fi
+export CFLAGS ROUNDING_MATH
+
+BUILD_DIR="$(mktemp -d /tmp/core-math.XXXXXX)"
+trap "rm -rf $BUILD_DIR" 0
+
+SUPPORT=$PWD/src/generic/support
+OBJS=""
+for u in src/binary32/*/Makefile src/binary64/*/Makefile; do
+    dir="${u%/Makefile}"
+    f="$(sed -n 's/FUNCTION_UNDER_TEST := //p' $u)"
+    shared="$(sed -n 's/SHARED_OBJS := //p' $u)"
+    case "$(grep -o 'Makefile\.[a-z]*' $u | head -1)" in
+        Makefile.univariate) kind=1 ;;
+        Makefile.bivariate) kind=2 ;;
+        Makefile.sincos) kind=3 ;;
+        *) continue ;;
+    esac
+    type=double
+    [ "${dir#src/binary32}" != "$dir" ] && type=float
+    make -s -C $dir clean
+    # without the definitions of the functions missing in the libm (such
+    # as rsqrt), which call core-math, so that they are missing here too
+    CFLAGS="$CFLAGS -DSKIP_C_FUNC_REDEF" make -s -C $dir $f.o $shared
+    cp $dir/$f.o $BUILD_DIR/
+    # a shared kernel is linked once
+    for o in $shared; do
+        kernel="${dir%/*}_$o"
+        cp -n $dir/$o $BUILD_DIR/${kernel//\//_}
+    done
+    make -s -C $dir clean
+    ${CC:-cc} $CFLAGS -DMIX_KIND=$kind -DTYPE_UNDER_TEST=$type \
+        -Dcr_function_under_test=cr_$f -Dfunction_under_test=$f \
+        -I src/generic/${dir##*/} -I $SUPPORT \
+        -c -o $BUILD_DIR/${f}_entry.o $SUPPORT/perf_mix_entry.c
+done
+
+${CC:-cc} $CFLAGS -W -Wall -I $SUPPORT -c -o $BUILD_DIR/perf_mix.o $SUPPORT/perf_mix.c
+${CC:-cc} $LDFLAGS -o $BUILD_DIR/perf-mix $BUILD_DIR/*.o -lm
+
+$CORE_MATH_LAUNCHER $BUILD_DIR/perf-mix "$@"
@@ -0,0 +1,190 @@
+#!/bin/bash
+# Usage:
+# ./perf-parallel.sh            (all functions)
+# ./perf-parallel.sh exp log    (some functions)
+# PERF_CPUS="2 4 6" ./perf-parallel.sh
+#
+# A faster and less noisy ./perf-all.sh: all the perf programs are built by
+# one parallel make, then the functions are measured concurrently, each
+# pinned with taskset to its own physical core. The cores are the isolated
+# ones (isolcpus=) if any, otherwise one hardware thread of each idle core
+# (except the core of cpu 0, which the system uses most), or PERF_CPUS.
+# The frequency governor, turbo and SMT are reported, since they add noise.
+#
+# Each function gets PERF_TRIALS runs of ./perf --rdtsc for core-math and
+# for the libc; if (median - min) / min exceeds PERF_MAX_SPREAD (0.05 by
+# default) for one of them, the runs are retried, up to PERF_RETRIES times.
+# The output has one line per function, as ./perf-all.sh: the minimum
+# cycles/call of core-math and of the libc, followed by "noisy" if the
+# spread remained too high. With CORE_MATH_RESULTS=file.csv, the trials
+# are also recorded as by ./perf.sh.
+
+set -e
+
+# this is to make the order of functions deterministic
+export LC_ALL=C
+
+S=${PERF_TRIALS:-20} # trial
+N=${PERF_COUNT:-100000} # count
+M=${PERF_REPEAT:-500} # repeat
+MAX_SPREAD=${PERF_MAX_SPREAD:-0.05}
+RETRIES=${PERF_RETRIES:-3}
+
+if [ "$CFLAGS" == "" ]; then
+   CFLAGS="-O3 -march=native"
+   ROUNDING_MATH="-frounding-math"
+fi
+export CFLAGS ROUNDING_MATH
+
+if [ $# -eq 0 ]; then
+    set -- $(for u in src/binary*/*/Makefile; do
+                 sed -n 's/FUNCTION_UNDER_TEST := //p' $u
+             done)
+fi
+DIRS=""
+for f in "$@"; do
+    u="$(echo src/binary*/*/$f.c)"
+    if [ ! -f "$u" ]; then
+        echo "Unknown function: $f" >&2
+        exit 2
+    fi
+    DIRS="$DIRS ${u%/*}"
+done
+
+SYS=/sys/devices/system/cpu
+
+# report what makes the measurements noisy
+governors="$(cat $SYS/cpu*/cpufreq/scaling_governor 2>/dev/null | sort -u | xargs echo)"
+echo "governor: ${governors:-unknown}" >&2
+if [ -n "$governors" ] && [ "$governors" != performance ]; then
+    echo "  (for stabler results: cpupower frequency-set -g performance)" >&2
+fi
+if [ -f $SYS/intel_pstate/no_turbo ]; then
+    [ "$(cat $SYS/intel_pstate/no_turbo)" = 1 ] && turbo=off || turbo=on
+elif [ -f $SYS/cpufreq/boost ]; then
+    [ "$(cat $SYS/cpufreq/boost)" = 1 ] && turbo=on || turbo=off
+else
+    turbo=unknown
+fi
+echo "turbo: $turbo" >&2
+if [ $turbo = on ]; then
+    echo "  (for stabler results: echo 1 > $SYS/intel_pstate/no_turbo," \
+         "or echo 0 > $SYS/cpufreq/boost)" >&2
+fi
+echo "SMT: $(cat $SYS/smt/active 2>/dev/null || echo unknown)" >&2
+
+# the busy and total jiffies of each cpu, from /proc/stat
+cpu_times () {
+    awk '/^cpu[0-9]/ { t = 0; for (k = 2; k <= NF; k++) t += $k;
+                       print substr($1, 4), t - $5 - $6, t }' /proc/stat
+}
+
+if [ -z "$PERF_CPUS" ]; then
+    PERF_CPUS="$(cat $SYS/isolated 2>/dev/null | tr , '\n' |
+                 awk -F- '/./ { for (c = $1; c <= ($2 == "" ? $1 : $2); c++)
+                                  printf "%d ", c }')"
+fi
+if [ -z "$PERF_CPUS" ]; then
+    # the first thread of each core which was less than 10% busy during
+    # one second
+    t0="$(cpu_times)"
+    sleep 1
+    t1="$(cpu_times)"
+    for c in $(echo "$t0" | awk '{print $1}'); do
+        first="$(sed 's/[,-].*//' $SYS/cpu$c/topology/thread_siblings_list 2>/dev/null || echo $c)"
+        [ "$first" = "$c" ] || continue
+        [ "$(cat $SYS/cpu0/topology/thread_siblings_list 2>/dev/null | sed 's/[,-].*//')" = "$c" ] && continue
+        busy="$( (echo "$t0"; echo "$t1") | awk -v c=$c '$1 == c { b[n] = $2; t[n++] = $3 }
+                  END { print (t[1] > t[0] && b[1] - b[0] > 0.1 * (t[1] - t[0])) }')"
+        [ "$busy" = 0 ] && PERF_CPUS="$PERF_CPUS $c"
+    done
+    # on a single core, or if all cores are busy
+    [ -n "$PERF_CPUS" ] || PERF_CPUS=0
+fi
+CPUS=($PERF_CPUS)
+echo "cpus: ${CPUS[*]}" >&2
+
+# build all the perf programs in one parallel make
+for d in $DIRS; do
+    make -s -C $d clean
+done
+{
+    echo "all: $DIRS"
+    for d in $DIRS; do
+        printf '%s:\n\t$(MAKE) -s -C %s perf\n' $d $d
+    done
+    echo ".PHONY: all $DIRS"
+} | make -s -j"$(nproc)" -f -
+
+TMP_DIR="$(mktemp -d /tmp/core-math.XXXXXX)"
+trap "rm -rf $TMP_DIR" 0
+
+# Measure function $1 (in directory $2) on cpu $3: print the minimum
+# cycles/call of core-math and of the libc, and record the trials in
+# $TMP_DIR/$1.core-math and $TMP_DIR/$1.libc.
+measure () {
+    local f=$1 dir=$2 cpu=$3 noisy
+    local randoms=$TMP_DIR/$f.randoms
+    (cd $dir; ./perf --file $randoms --count $N --reference \
+        ${PERF_DIST:+--dist "$PERF_DIST"} 2> /dev/null)
+    for try in $(seq 0 $RETRIES); do
+        noisy=""
+        for impl in core-math libc; do
+            local args="--file $randoms --count $N --repeat $M --rdtsc $PERF_ARGS"
+            [ $impl = libc ] && args="$args --libc"
+            for i in $(seq $S); do
+                $CORE_MATH_LAUNCHER taskset -c $cpu $dir/perf $args
+            done > $TMP_DIR/$f.$impl
+            spread="$(sort -g $TMP_DIR/$f.$impl | awk -v s=$MAX_SPREAD \
+                      '{ a[n++] = $1 } END { print ((a[int(n/2)] - a[0]) > s * a[0]) }')"
+            [ "$spread" = 1 ] && noisy=noisy
+        done
+        [ -z "$noisy" ] && break
+    done
+    echo $f $(sort -g $TMP_DIR/$f.core-math | head -1) \
+         $(sort -g $TMP_DIR/$f.libc | head -1) $noisy
+}
+
+# the functions are dealt to the cpus in turn
+set -- $DIRS
+for k in "${!CPUS[@]}"; do
+    (
+        i=0
+        for d in "$@"; do
+            if [ $(( i % ${#CPUS[@]} )) = $k ]; then
+                f="$(sed -n 's/FUNCTION_UNDER_TEST := //p' $d/Makefile)"
+                measure $f $d ${CPUS[$k]} > $TMP_DIR/$f.out
+            fi
+            i=$(( i + 1 ))
+        done
+    ) &
+done
+wait
+
+for d in $DIRS; do
+    f="$(sed -n 's/FUNCTION_UNDER_TEST := //p' $d/Makefile)"
+    cat $TMP_DIR/$f.out
+    make -s -C $d clean
+done
+
+if [ -n "$CORE_MATH_RESULTS" ]; then
+    [ -x src/generic/support/glibc_version ] || make -s -C src/generic/support glibc_version
+    glibc="$($CORE_MATH_LAUNCHER src/generic/support/glibc_version | sed -n 's/GNU libc version: //p')"
+    compiler="$(${CC:-cc} --version 2>/dev/null | head -1)"
+    cpu="$(sed -n 's/^model name[^:]*: //p' /proc/cpuinfo 2>/dev/null | head -1)"
+    [ -n "$cpu" ] || cpu="$(uname -m)"
+    metric=throughput
+    case " $PERF_ARGS " in
+        *" --latency "*) metric=latency ;;
+    esac
+    if [ ! -s "$CORE_MATH_RESULTS" ]; then
+        echo "function,type,impl,mode,metric,compiler,cflags,cpu,glibc,trials" > "$CORE_MATH_RESULTS"
+    fi
+    for d in $DIRS; do
+        f="$(sed -n 's/FUNCTION_UNDER_TEST := //p' $d/Makefile)"
+        type="${d#src/}"
+        for impl in core-math libc; do
+            echo "$f,${type%%/*},$impl,rdtsc,$metric,\"${compiler//\"/\"\"}\",\"${CFLAGS//\"/\"\"}\",\"${cpu//\"/\"\"}\",$glibc,$(paste -s -d ';' $TMP_DIR/$f.$impl)"
+        done
+    done >> "$CORE_MATH_RESULTS"
+fi
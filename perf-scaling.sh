@@ -0,0 +1,81 @@
+#!/bin/bash
+# Usage:
+# ./perf-scaling.sh             (all functions)
+# ./perf-scaling.sh exp log     (some functions)
+# PERF_THREADS="1 2 4 8" ./perf-scaling.sh exp
+#
+# For each function and each number N of threads, run ./perf --threads N
+# (see src/generic/support/perf_common.h) and print the aggregate
+# cycles/call and the efficiency, i.e., the aggregate cycles/call with one
+# thread divided by N times the one with N threads (1 for perfect scaling).
+# The results are written to perf-scaling.dat and, if gnuplot is installed,
+# plotted in perf-scaling.png.
+
+set -e
+
+# this is to make the order of functions deterministic
+export LC_ALL=C
+
+N=${PERF_COUNT:-100000} # count
+M=${PERF_REPEAT:-100} # repeat
+NCPUS=$(nproc)
+if [ -z "$PERF_THREADS" ]; then
+    PERF_THREADS=""
+    n=1
+    while [ $n -lt $NCPUS ]; do
+        PERF_THREADS="$PERF_THREADS $n"
+        n=$(( n * 2 ))
+    done
+    PERF_THREADS="$PERF_THREADS $NCPUS"
+fi
+
+if [ "$CFLAGS" == "" ]; then
+   CFLAGS="-O3 -march=native"
+   ROUNDING_MATH="-frounding-math"
+fi
+export CFLAGS ROUNDING_MATH
+
+if [ $# -eq 0 ]; then
+    set -- $(for u in src/binary*/*/Makefile; do
+                 sed -n 's/FUNCTION_UNDER_TEST := //p' $u
+             done)
+fi
+
+RANDOMS_FILE="$(mktemp /tmp/core-math.XXXXXX)"
+DAT_FILE="$PWD/perf-scaling.dat"
+trap "rm -f $RANDOMS_FILE" 0
+
+echo "# function threads cycles/call efficiency" > $DAT_FILE
+for f in "$@"; do
+    u="$(echo src/binary*/*/$f.c)"
+    if [ ! -f "$u" ]; then
+        echo "Unknown function: $f" >&2
+        exit 2
+    fi
+    (
+        cd "${u%/*}"
+        make -s clean
+        make -s perf
+        ./perf --file $RANDOMS_FILE --count $N --reference ${PERF_DIST:+--dist "$PERF_DIST"} 2> /dev/null
+        one=
+        for n in $PERF_THREADS; do
+            c=$($CORE_MATH_LAUNCHER ./perf --file $RANDOMS_FILE --count $N --repeat $M --threads $n | awk '/^aggregate/{print $2}')
+            [ -z "$one" ] && one=$c
+            echo "$f $n $c $(echo "$one $n $c" | awk '{printf "%.3f", $1/($2*$3)}')"
+        done
+        make -s clean
+    ) | tee -a $DAT_FILE
+done
+
+if command -v gnuplot > /dev/null; then
+    gnuplot <<EOF
+set terminal png size 1200,800
+set output "perf-scaling.png"
+set xlabel "threads"
+set ylabel "efficiency"
+set yrange [0:1.2]
+set key outside right
+plot for [f in "$*"] "< grep '^'.f.' ' $DAT_FILE" using 2:4 with linespoints title f
+EOF
+    echo "plot in perf-scaling.png" >&2
+fi
@@ -0,0 +1,52 @@
+#!/bin/bash
+# Usage:
+# ./perf-special.sh                 (all functions)
+# ./perf-special.sh exp hypot cbrt  (some functions)
+#
+# Measures each function, for core-math and for the libc, on the special
+# inputs: NaN, +/-Inf, +/-0, subnormals, and inputs giving a subnormal
+# result (see src/generic/support/perf_special.h), and prints for each
+# class the cycles/call, the ratio to the normal inputs and the
+# floating-point assists per call (with the Intel FP assist counters, n/a
+# elsewhere, or if perf_event_paranoid is too high, see README.md).
+# PERF_COUNT (100000 by default) and PERF_REPEAT (10) are the number of
+# inputs per class and the number of passes.
+
+set -e
+
+# this is to make the order of functions deterministic
+export LC_ALL=C
+
+N=${PERF_COUNT:-100000} # count
+M=${PERF_REPEAT:-10} # repeat
+
+if [ "$CFLAGS" == "" ]; then
+   CFLAGS="-O3 -march=native"
+   ROUNDING_MATH="-frounding-math"
+fi
+export CFLAGS ROUNDING_MATH
+
+if [ $# -eq 0 ]; then
+    set -- $(for u in src/binary*/*/Makefile; do
+                 sed -n 's/FUNCTION_UNDER_TEST := //p' $u
+             done)
+fi
+
+for f in "$@"; do
+    u="$(echo src/binary*/*/$f.c)"
+    if [ ! -f "$u" ]; then
+        echo "Unknown function: $f" >&2
+        exit 2
+    fi
+    dir="${u%/*}"
+    make -s -C $dir clean
+    make -s -C $dir perf
+    for impl in core-math libc; do
+        args="--special --count $N --repeat $M $PERF_ARGS"
+        [ $impl = libc ] && args="$args --libc"
+        echo "$f ($impl)"
+        $CORE_MATH_LAUNCHER $dir/perf $args
+        echo
+    done
+    make -s -C $dir clean
+done
@@ -0,0 +1,75 @@
+#!/bin/bash
+# Usage:
+# ./perf-worst.sh               (all functions with a .wc file)
+# ./perf-worst.sh exp log powf  (some functions)
+#
+# For each function, measure the reciprocal throughput and the latency of
+# core-math in cycles/call (with ./perf --rdtsc), on the default random
+# inputs, which mostly take the fast path, and on the worst cases of its
+# .wc file (./perf --dist worst, see src/generic/support/perf_dist.h),
+# which mostly take the accurate path. Each number is the minimum over
+# PERF_TRIALS runs. The output has one line per function:
+#   function random-throughput random-latency worst-throughput worst-latency entries
+
+set -e
+
+# this is to make the order of functions deterministic
+export LC_ALL=C
+
+S=${PERF_TRIALS:-5} # trial
+N=${PERF_COUNT:-100000} # count
+M=${PERF_REPEAT:-20} # repeat
+
+if [ "$CFLAGS" == "" ]; then
+   CFLAGS="-O3 -march=native"
+   ROUNDING_MATH="-frounding-math"
+fi
+export CFLAGS ROUNDING_MATH
+
+if [ $# -eq 0 ]; then
+    set -- $(for u in src/binary*/*/*.wc; do
+                 basename $u .wc
+             done)
+fi
+
+RANDOMS_FILE="$(mktemp /tmp/core-math.XXXXXX)"
+LOG_FILE="$(mktemp /tmp/core-math.XXXXXX)"
+trap "rm -f $RANDOMS_FILE $LOG_FILE" 0
+
+# minimum cycles/call over S runs of ./perf with the given arguments
+min_rdtsc () {
+    local i=1
+    while [ $i -le $S ]; do
+        $CORE_MATH_LAUNCHER ./perf --file $RANDOMS_FILE --count $N --repeat $M --rdtsc "$@"
+        i=$(( i + 1 ))
+    done | sort -g | head -1
+}
+
+echo "# function random-throughput random-latency worst-throughput worst-latency entries"
+for f in "$@"; do
+    u="$(echo src/binary*/*/$f.c)"
+    if [ ! -f "$u" ]; then
+        echo "Unknown function: $f" >&2
+        exit 2
+    fi
+    if [ ! -f "${u%.c}.wc" ]; then
+        echo "No worst cases for $f; skipping" >&2
+        continue
+    fi
+    (
+        cd "${u%/*}"
+        make -s clean
+        make -s perf
+        ./perf --file $RANDOMS_FILE --count $N --reference
+        r="$(min_rdtsc) $(min_rdtsc --latency)"
+        if ! ./perf --file $RANDOMS_FILE --count $N --reference --dist worst 2> $LOG_FILE; then
+            echo "$f: $(cat $LOG_FILE); skipping" >&2
+            make -s clean
+            exit 0
+        fi
+        w="$(min_rdtsc) $(min_rdtsc --latency)"
+        n=$(sed -n 's/^inputs: worst (\([0-9]*\) entries.*/\1/p' $LOG_FILE)
+        echo "$f $r $w $n"
+        make -s clean
+    )
+done
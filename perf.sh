@@ -56,7 +56,7 @@ collect_perf_stat () {
     fi
     local i=1
     while [ $i -le $S ]; do
-        perf stat -e cycles -x " " $CORE_MATH_LAUNCHER ./perf $PERF_ARGS &>> $LOG_FILE
+        perf stat -e cycles -x " " $CORE_MATH_LAUNCHER $PERF_PROG $PERF_ARGS &>> $LOG_FILE
         if [ -z "$CORE_MATH_QUIET" ]; then
             prog_bar $S $i
         fi
@@ -67,12 +67,13 @@ process_perf_stat () {
     sort -g -k 1 $LOG_FILE | awk "/cycles/{a[i++]=\$1/(${N}*${M});} ${prog_end}"
 }
 perform_perf_stat () {
-    perf stat -e cycles -x " " $CORE_MATH_LAUNCHER ./perf $PERF_ARGS 2>&1 | awk "/cycles/{print \$1/(${N}*${M})}"
+    perf stat -e cycles -x " " $CORE_MATH_LAUNCHER $PERF_PROG $PERF_ARGS 2>&1 | awk "/cycles/{print \$1/(${N}*${M})}"
 }
 proc_perf () {
     if [ -z "$CORE_MATH_SIMPLE_STAT" ]; then
         collect_perf_stat
         process_perf_stat
+        awk "/cycles/{print \$1/(${N}*${M})}" $LOG_FILE | record_results
     else
         perform_perf_stat
     fi
@@ -85,32 +86,66 @@ collect_rdtsc_stat () {
     fi
     local i=1
     while [ $i -le $S ]; do
-        $CORE_MATH_LAUNCHER ./perf $PERF_ARGS &>> $LOG_FILE
+        $CORE_MATH_LAUNCHER $PERF_PROG $PERF_ARGS &>> $LOG_FILE
         if [ -z "$CORE_MATH_QUIET" ]; then
             prog_bar $S $i
         fi
         i=$(( i + 1 ))
     done
 }
+# the log also has the inputs line that ./perf prints on stderr
 process_rdtsc_stat () {
-    sort -g $LOG_FILE | awk "{a[i++]=\$1;} ${prog_end}"
+    sort -g $LOG_FILE | awk "/^[0-9]/{a[i++]=\$1;} ${prog_end}"
 }
 perform_rdtsc_stat () {
-    $CORE_MATH_LAUNCHER ./perf $PERF_ARGS
+    $CORE_MATH_LAUNCHER $PERF_PROG $PERF_ARGS
 }
 proc_rdtsc () {
     if [ -z "$CORE_MATH_SIMPLE_STAT" ]; then
         collect_rdtsc_stat
         process_rdtsc_stat
+        awk '/^[0-9]/' $LOG_FILE | record_results
     else
         perform_rdtsc_stat
     fi
 }
 
+# With CORE_MATH_RESULTS=file.csv, append to file.csv a row with the
+# cycles/call of each trial (read on stdin) for the implementation $IMPL,
+# the distribution of the inputs (PERF_DIST), the PERF_ARGS given to
+# perf.sh, and the settings of the run (compare two such files with
+# ./perf-compare.sh). Nothing is recorded with CORE_MATH_SIMPLE_STAT.
+csv_quote () {
+    echo -n "\"${1//\"/\"\"}\""
+}
+record_results () {
+    if [ -z "$CORE_MATH_RESULTS" ]; then
+        cat > /dev/null
+        return
+    fi
+    local trials="$(paste -s -d ';')"
+    if [ ! -s "$CORE_MATH_RESULTS" ]; then
+        echo "function,type,impl,mode,metric,dist,args,compiler,cflags,cpu,glibc,trials" > "$CORE_MATH_RESULTS"
+    fi
+    echo "$f,$TYPE,$IMPL,$CORE_MATH_PERF_MODE,$METRIC,$(csv_quote "${PERF_DIST:-default}"),$(csv_quote "$ARGS"),$(csv_quote "$COMPILER"),$(csv_quote "$CFLAGS"),$(csv_quote "$CPU"),$GLIBC,$trials" >> "$CORE_MATH_RESULTS"
+}
+
+# one run with the hardware counters of perf_events.h, printing the value
+# of each counter (per call, or IPC, or percentage of the slots), and
+# setting NCOUNTERS to their number
+proc_counters () {
+    local values="$($CORE_MATH_LAUNCHER $PERF_PROG $PERF_ARGS --counters | awk '{print $2}')"
+    echo "$values"
+    NCOUNTERS=$(echo "$values" | wc -l)
+}
+
 has_symbol () {
     [ "$(nm "$LIBM" | while read a b c; do if [ "$c" = "$f" ]; then echo OK; return; fi; done | wc -l)" -ge 1 ]
 }
 
+# the program measured, ./perf-pgo and ./perf-bolt with CORE_MATH_PERF_PGO
+PERF_PROG=./perf
+
 RANDOMS_FILE="$(mktemp /tmp/core-math.XXXXXX)"
 LOG_FILE="$(mktemp /tmp/core-math.XXXXXX)"
 # trap "rm -f $RANDOMS_FILE $LOG_FILE" 0
@@ -120,7 +155,7 @@ u="$(echo src/binary*/*/$f.c)"
 
 if [ -z "$CORE_MATH_PERF_MODE" ]; then
     if [ -z "$CORE_MATH_QUIET" ]; then
-        echo 'CORE_MATH_PERF_MODE (perf or rdtsc) environment variable is not set. The default is perf.'
+        echo 'CORE_MATH_PERF_MODE (perf, rdtsc or counters) environment variable is not set. The default is perf.'
     fi
     CORE_MATH_PERF_MODE=perf
 fi
@@ -145,6 +180,27 @@ if [ "$CFLAGS" == "" ]; then
 fi
 export CFLAGS ROUNDING_MATH
 
+if [ -n "$CORE_MATH_RESULTS" ]; then
+    # perf.sh runs in the directory of the function
+    case "$CORE_MATH_RESULTS" in
+        /*) ;;
+        *) CORE_MATH_RESULTS="$PWD/$CORE_MATH_RESULTS" ;;
+    esac
+    TYPE="${dir#src/}"
+    TYPE="${TYPE%%/*}"
+    # the options of the user, before perf.sh adds its own
+    ARGS="$(echo $PERF_ARGS)"
+    METRIC=throughput
+    case " $PERF_ARGS " in
+        *" --latency "*) METRIC=latency ;;
+    esac
+    COMPILER="$(${CC:-cc} --version 2>/dev/null | head -1)"
+    CPU="$(sed -n 's/^model name[^:]*: //p' /proc/cpuinfo 2>/dev/null | head -1)"
+    [ -n "$CPU" ] || CPU="$(uname -m)"
+    [ -x src/generic/support/glibc_version ] || make -s -C src/generic/support glibc_version
+    GLIBC="$($CORE_MATH_LAUNCHER src/generic/support/glibc_version | sed -n 's/GNU libc version: //p')"
+fi
+
 if [ -n "$LIBM" ]; then
     BACKUP_LIBM="$LIBM"
     unset LIBM
@@ -168,14 +224,18 @@ cd $dir
 make -s clean
 make -s perf
 
-# prepare random arguments for performance test
-./perf --file ${RANDOMS_FILE} --count ${N} --reference
+# prepare random arguments for performance test (PERF_DIST selects their
+# distribution, see src/generic/support/perf_dist.h, and is also given to
+# the timing runs, which print it)
+./perf --file ${RANDOMS_FILE} --count ${N} --reference ${PERF_DIST:+--dist "$PERF_DIST"}
 
-PERF_ARGS="${PERF_ARGS} --file ${RANDOMS_FILE} --count ${N} --repeat ${M}"
+PERF_ARGS="${PERF_ARGS} --file ${RANDOMS_FILE} --count ${N} --repeat ${M}${PERF_DIST:+ --dist $PERF_DIST}"
 
+IMPL=core-math
 if [ "$CORE_MATH_PERF_MODE" = perf ]; then
     proc_perf
 
+    IMPL=libc
     PERF_ARGS="${PERF_ARGS} --libc"
     proc_perf
 
@@ -183,8 +243,41 @@ elif [ "$CORE_MATH_PERF_MODE" = rdtsc ]; then
     PERF_ARGS="${PERF_ARGS} --rdtsc"
     proc_rdtsc
 
+    IMPL=libc
     PERF_ARGS="${PERF_ARGS} --libc"
     proc_rdtsc
+
+elif [ "$CORE_MATH_PERF_MODE" = counters ]; then
+    proc_counters
+
+    PERF_ARGS="${PERF_ARGS} --libc"
+    proc_counters
+fi
+
+# With CORE_MATH_PERF_PGO=1, also measure core-math built with a profile of
+# its branches, and with CORE_MATH_PERF_PGO=bolt, also after llvm-bolt (see
+# the perf-pgo and perf-bolt targets in src/generic/support/Makefile.*).
+if [ -n "$CORE_MATH_PERF_PGO" ]; then
+    PERF_ARGS="${PERF_ARGS% --libc}"
+    progs=perf-pgo
+    [ "$CORE_MATH_PERF_PGO" = bolt ] && progs="perf-pgo perf-bolt"
+    for p in $progs; do
+        if ! make -s $p > /dev/null 2>&1; then
+            echo "Error, cannot build $p in $dir" >&2
+            exit 1
+        fi
+        PERF_PROG=./$p
+        IMPL=core-math-${p#perf-}
+        if [ "$CORE_MATH_PERF_MODE" = perf ]; then
+            proc_perf
+        elif [ "$CORE_MATH_PERF_MODE" = rdtsc ]; then
+            proc_rdtsc
+        elif [ "$CORE_MATH_PERF_MODE" = counters ]; then
+            proc_counters
+        fi
+    done
+    PERF_PROG=./perf
+    PERF_ARGS="${PERF_ARGS} --libc"
 fi
 
 has_symbol () {
@@ -194,6 +287,7 @@ has_symbol () {
 if [ -n "$BACKUP_LIBM" ]; then
     export LIBM="$BACKUP_LIBM"
     if has_symbol; then
+        IMPL="$(basename "$LIBM" .a)"
         PERF_ARGS="${PERF_ARGS} --libc"
         make -s clean
         make -s perf
@@ -203,8 +297,17 @@ if [ -n "$BACKUP_LIBM" ]; then
         elif [ "$CORE_MATH_PERF_MODE" = rdtsc ]; then
             PERF_ARGS="${PERF_ARGS} --rdtsc"
             proc_rdtsc
+
+        elif [ "$CORE_MATH_PERF_MODE" = counters ]; then
+            proc_counters
+        fi
+    else
+        # one n/a per counter, to keep the columns of perf-all.sh aligned
+        if [ "$CORE_MATH_PERF_MODE" = counters ]; then
+            for i in $(seq $NCOUNTERS); do echo n/a; done
+        fi
+        if [ -z "$CORE_MATH_QUIET" ]; then
+            echo "$f is not present in $LIBM; skipping" >&2
         fi
-    elif [ -z "$CORE_MATH_QUIET" ]; then
-        echo "$f is not present in $LIBM; skipping" >&2
     fi
 fi
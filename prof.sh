@@ -27,7 +27,7 @@ COMMON_PERF_ARGS=(--file "$RANDOMS_FILE" --count 1000000)
 cd $dir
 make -s clean
 make -s perf
-./perf "${COMMON_PERF_ARGS[@]}" --reference
+./perf "${COMMON_PERF_ARGS[@]}" --reference ${PERF_DIST:+--dist "$PERF_DIST"}
 
 perf record --output="$PERF_DATA_FILE" ./perf "${COMMON_PERF_ARGS[@]}" --repeat 500
 perf annotate --input="$PERF_DATA_FILE"
@@ -27,6 +27,16 @@ SOFTWARE.
 #include <stdint.h>
 #include <errno.h>
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -38,6 +48,7 @@ typedef union {float f; uint32_t u;} b32u32_u;
 typedef union {double f; uint64_t u;} b64u64_u;
 
 static __attribute__((noinline)) float as_special(float x){
+  CORE_MATH_STAT("as_special");
   const float pih = 0x1.921fb6p+1f, pil = -0x1p-24f;
   b32u32_u t = {.f = x};
   if(t.u == (0x7fu<<23)) return 0.0f; // x=1
@@ -66,6 +77,8 @@ static double poly12(double z, const double *c){
 }
 
 float cr_acosf(float x){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x);
   const double pi2 = 0x1.921fb54442d18p+0;
   static const double o[] = {0, 0x1.921fb54442d18p+1};
   double xs = x, r;
@@ -27,6 +27,16 @@ SOFTWARE.
 #include <stdint.h>
 #include <errno.h>
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -37,6 +47,7 @@ SOFTWARE.
 typedef union {float f; uint32_t u;} b32u32_u;
 
 static __attribute__((noinline)) float as_special(float x){
+  CORE_MATH_STAT("as_special");
   b32u32_u t = {.f = x};
   uint32_t ax = t.u<<1;
   if(ax>(0xffu<<24)) return x + x; // nan
@@ -62,6 +73,8 @@ static double poly12(double z, const double *c){
 }
 
 float cr_asinf(float x){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x);
   const double pi2 = 0x1.921fb54442d18p+0;
   double xs = x, r;
   b32u32_u t = {.f = x};
@@ -29,6 +29,16 @@ SOFTWARE.
 #include <errno.h>
 #include <fenv.h>
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -39,6 +49,8 @@ SOFTWARE.
 typedef union {float f; uint32_t u;} b32u32_u;
 
 float cr_asinpif(float x){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x);
   float ax = __builtin_fabsf(x);
   double az = ax, z = x;
   b32u32_u t = {.f = x};
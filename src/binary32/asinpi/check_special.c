@@ -181,5 +181,8 @@ main (int argc, char *argv[])
 
   check_near_underflow ();
 
+#ifdef CORE_MATH_STATS
+  cr_stats_dump ();
+#endif
   return 0;
 }
@@ -26,6 +26,16 @@ SOFTWARE.
 
 #include <stdint.h>
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -38,6 +48,8 @@ typedef union {double f; uint64_t u;} b64u64_u;
 typedef uint64_t u64;
 
 float cr_atanf(float x){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x);
   const double pi2 = 0x1.921fb54442d18p+0;
   b32u32_u t = {.f = x};
   int e = (t.u>>23)&0xff, gt = e>=127;
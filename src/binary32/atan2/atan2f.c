@@ -28,6 +28,16 @@ SOFTWARE.
 #include <stdint.h>
 #include <errno.h>
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -63,6 +73,7 @@ static double polydd(double xh, double xl, int n, const double c[][2], double *l
 static float
 cr_atan2f_tiny (float y, float x)
 {
+  CORE_MATH_STAT("cr_atan2f_tiny");
   double dy = y, dx = x;
   double z = dy / dx;
   double e = __builtin_fma (-z, x, y);
@@ -86,6 +97,8 @@ cr_atan2f_tiny (float y, float x)
 }
 
 float cr_atan2f(float y, float x){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(y, x);
   static const double cn[] =
     {0x1p+0, 0x1.40e0698f94c35p+1, 0x1.248c5da347f0dp+1, 0x1.d873386572976p-1, 0x1.46fa40b20f1dp-3,
      0x1.33f5e041eed0fp-7, 0x1.546bbf28667c5p-14};
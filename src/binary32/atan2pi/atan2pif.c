@@ -28,6 +28,16 @@ SOFTWARE.
 #include <stdint.h>
 #include <errno.h>
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -60,6 +70,8 @@ static double polydd(double xh, double xl, int n, const double c[][2], double *l
 }
 
 float cr_atan2pif(float y, float x){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(y, x);
   static const double cn[] =
     {0x1.45f306dc9c883p-2, 0x1.988d83a142adap-1, 0x1.747bebf492057p-1, 0x1.2cc5645094ff3p-2,
      0x1.a0521c711ab66p-5, 0x1.881b8058b9a0dp-9, 0x1.b16ff514a0afp-16};
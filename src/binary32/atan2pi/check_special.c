@@ -311,5 +311,8 @@ main (int argc, char *argv[])
 #endif
   for (int i = 0; i < nthreads; i++)
     check_random (getpid () + i, nthreads);
+#ifdef CORE_MATH_STATS
+  cr_stats_dump ();
+#endif
   return 0;
 }
@@ -27,6 +27,16 @@ SOFTWARE.
 
 #include <stdint.h>
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -37,6 +47,8 @@ SOFTWARE.
 typedef union {float f; uint32_t u;} b32u32_u;
 
 float cr_atanpif(float x){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x);
   b32u32_u t = {.f = x};
   int32_t e = (t.u>>23)&0xff, gt = e>=127;
   if(__builtin_expect(e>127+24, 0)) {
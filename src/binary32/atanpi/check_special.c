@@ -125,5 +125,8 @@ main (int argc, char *argv[])
 
   check_spurious_underflow ();
 
+#ifdef CORE_MATH_STATS
+  cr_stats_dump ();
+#endif
   return 0;
 }
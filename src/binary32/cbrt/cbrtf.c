@@ -27,6 +27,16 @@ SOFTWARE.
 #include <stdint.h>
 #include <fenv.h>
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -100,6 +110,8 @@ static inline void set_flags (const fexcept_t *flagp)
 #endif
 
 float cr_cbrtf (float x){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x);
   static const double escale[3] = {1.0, 0x1.428a2f98d728bp+0/* 2^(1/3) */, 0x1.965fea53d6e3dp+0/* 2^(2/3) */};
 #ifdef CORE_MATH_CHECK_INEXACT
   fexcept_t flag;
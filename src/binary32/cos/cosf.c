@@ -27,6 +27,21 @@ SOFTWARE.
 #include <stdint.h>
 #include <errno.h>
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
+/* phase markers of the CORE_MATH_PROFILE builds, see generic/support/profile.h */
+#ifndef CORE_MATH_PHASE
+#define CORE_MATH_PHASE(name)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -79,6 +94,7 @@ typedef unsigned __int128 u128;
 typedef uint64_t u64;
 
 static double __attribute__((noinline)) rbig(uint32_t u, int *q){
+  CORE_MATH_STAT("rbig");
   static const u64 ipi[] = {0xfe5163abdebbc562, 0xdb6295993c439041, 0xfc2757d1f534ddc0, 0xa2f9836e4e441529};
   int e = (u>>23)&0xff, i;
   u64 m = (u&(~0u>>9))|1<<23;
@@ -124,6 +140,7 @@ static inline double rltl0(double x, int *q){
 }
 
 static float __attribute__((noinline)) as_cosf_database(float x, double r){
+  CORE_MATH_STAT("as_cosf_database");
   static const struct {union{float arg; uint32_t uarg;}; float rh, rl;} st[] = {
     {{0x1.2d97c8p+2}, 0x1.99bc5cp-27, -0x1p-52},
     {{0x1.4555p+51}, 0x1.115d7ep-1, -0x1p-26},
@@ -153,6 +170,7 @@ static const double tb[] =
    0x1.6a09e667f3bcdp-1, 0x1.a9b66290ea1a3p-1, 0x1.d906bcf328d46p-1, 0x1.f6297cff75cbp-1};
 
 static float __attribute__((noinline)) as_cosf_big(float x){
+  CORE_MATH_STAT("as_cosf_big");
   b32u32_u t = {.f = x};
   uint32_t ax = t.u<<1;
   if(__builtin_expect(ax>=0xffu<<24, 0)){ // nan or +-inf
@@ -175,6 +193,9 @@ static float __attribute__((noinline)) as_cosf_big(float x){
 }
 
 float cr_cosf(float x){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x);
+  CORE_MATH_PHASE("filter");
   b32u32_u t = {.f = x};
   uint32_t ax = t.u<<1;
   int ia;
@@ -191,13 +212,17 @@ float cr_cosf(float x){
   }
   if(__builtin_expect(ax<0x82a41896u, 1)){
     if(__builtin_expect(ax==0x812d97c8u, 0)) return as_cosf_database(x, 0.0);
+    CORE_MATH_PHASE("reduction");
     z = rltl0(z0, &ia);
   } else {
+    CORE_MATH_PHASE("reduction");
     z = rltl(z0, &ia);
   }
+  CORE_MATH_PHASE("polynomial");
   double z2 = z*z, z4 = z2*z2;
   double aa = (a[0] + z2*a[1]) + z4*(a[2] + z2*a[3]);
   double bb = (b[0] + z2*b[1]) + z4*(b[2] + z2*b[3]);
+  CORE_MATH_PHASE("reconstruction");
   double c0 = tb[ia&31], s0 = tb[(ia+8)&31];
   double r = c0 + aa*(z*s0) - bb*(z2*c0);
   return r;
@@ -29,6 +29,16 @@ SOFTWARE.
 #include <errno.h>
 #include <fenv.h>
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -39,6 +49,8 @@ SOFTWARE.
 typedef union {float f; uint32_t u;} b32u32_u;
 
 float cr_cospif(float x){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x);
   static const double sn[] = { 0x1.921fb54442d0fp-37, -0x1.4abbce6102b94p-112,  0x1.4669fa3c58463p-189};
   static const double cn[] = {-0x1.3bd3cc9be45cfp-74, 0x1.03c1f08088742p-150, -0x1.55d1e5eff55a5p-228};
   // S[i] approximates sin(i*pi/2^6)
@@ -26,6 +26,16 @@ SOFTWARE.
 
 #include <stdint.h>
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -37,9 +47,12 @@ typedef union {float f; uint32_t u;} b32u32_u;
 typedef union {double f; uint64_t u;} b64u64_u;
 
 float cr_erff(float x){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x);
   /* for 7 <= i < 63, C[i-7] is a degree-7 polynomial approximation of
-     erf(i/16+1/32+x) for -1/32 <= x <= 1/32 */
-  static const double C[56][8] = {
+     erf(i/16+1/32+x) for -1/32 <= x <= 1/32; each row is 64 bytes, and
+     the table is aligned so that a row is exactly one cache line */
+  static const double C[56][8] __attribute__((aligned(64))) = {
     {0x1.f86faa9428f9cp-2, 0x1.cfc41e36c7dfap-1, -0x1.b2c7dc53508b9p-2, -0x1.5a9de93fa556ep-3, 0x1.731793dbb01b5p-3, 0x1.133e06426cf18p-6, -0x1.a12a6289cafd8p-5, 0x1.717d6f1d6f557p-9},
     {0x1.1855a5fd3dd50p-1, 0x1.b3aafcc27502fp-1, -0x1.cee5ac8e92bb2p-2, -0x1.fa02983ca2d79p-4, 0x1.77cd746cb1922p-3, -0x1.fa6f277886487p-10, -0x1.8de75458db416p-5, 0x1.00899c98551c9p-7},
     {0x1.32a54cb8db67ap-1, 0x1.96164fafd8de5p-1, -0x1.e23a7ea0c9ad3p-2, -0x1.3f5ee15671cf4p-4, 0x1.70e468a3d72d9p-3, -0x1.3da68037cfc99p-6, -0x1.69ed9ba1f9839p-5, 0x1.8cab9244a4ff4p-7},
@@ -118,5 +118,8 @@ main (int argc, char *argv[])
   check_errno ();
 #endif
 
+#ifdef CORE_MATH_STATS
+  cr_stats_dump ();
+#endif
   return 0;
 }
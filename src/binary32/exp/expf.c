@@ -27,6 +27,21 @@ SOFTWARE.
 #include <stdint.h>
 #include <errno.h>
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
+/* phase markers of the CORE_MATH_PROFILE builds, see generic/support/profile.h */
+#ifndef CORE_MATH_PHASE
+#define CORE_MATH_PHASE(name)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -38,12 +53,15 @@ typedef union {float f; uint32_t u;} b32u32_u;
 typedef union {double f; uint64_t u;} b64u64_u;
 
 float cr_expf(float x){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x);
+  CORE_MATH_PHASE("filter");
   static const double c[] =
     {0x1.62e42fefa39efp-1, 0x1.ebfbdff82c58fp-3, 0x1.c6b08d702e0edp-5,
      0x1.3b2ab6fb92e5ep-7, 0x1.5d886e6d54203p-10, 0x1.430976b8ce6efp-13};
   static const double b[] =
     {1, 0x1.62e42fef4c4e7p-1, 0x1.ebfd1b232f475p-3, 0x1.c6b19384ecd93p-5};
-  static const uint64_t tb[] =
+  static const uint64_t tb[] __attribute__((aligned(64))) =
     {0x3ff0000000000000, 0x3ff02c9a3e778061, 0x3ff059b0d3158574, 0x3ff0874518759bc8,
      0x3ff0b5586cf9890f, 0x3ff0e3ec32d3d1a2, 0x3ff11301d0125b51, 0x3ff1429aaea92de0,
      0x3ff172b83c7d517b, 0x3ff1a35beb6fcb75, 0x3ff1d4873168b9aa, 0x3ff2063b88628cd6,
@@ -89,9 +107,12 @@ float cr_expf(float x){
       return r;
     }
   }
+  CORE_MATH_PHASE("reduction");
   double ia = big - u.f, h = a + ia;
   b64u64_u sv = {.u = tb[u.u&0x3f] + ((u.u>>6)<<52)};
+  CORE_MATH_PHASE("polynomial");
   double h2 = h*h, r = ((b[0] + h*b[1]) + h2*(b[2] + h*(b[3])))*sv.f;
+  CORE_MATH_PHASE("rounding test");
   float ub = r, lb = r - r*1.45e-10;
   if(__builtin_expect(ub != lb, 0)){
     const double iln2h = 0x1.7154765p+0, iln2l = 0x1.5c17f0bbbe88p-31;
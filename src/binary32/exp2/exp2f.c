@@ -32,6 +32,16 @@ SOFTWARE.
 #include <fenv.h>
 #endif
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -43,6 +53,7 @@ typedef union {float f; uint32_t u;} b32u32_u;
 typedef union {double f; uint64_t u;} b64u64_u;
 
 static float as_special(float x){
+  CORE_MATH_STAT("as_special");
   b32u32_u t = {.f = x};
   uint32_t ux = t.u<<1;
   if(ux >= 0xffu<<24) { // x is inf or nan
@@ -67,7 +78,9 @@ static float as_special(float x){
 }
 
 float cr_exp2f(float x){
-  static const b64u64_u tb[] =
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x);
+  static const b64u64_u tb[] __attribute__((aligned(64))) =
     {{0x1.0000000000000p+0}, {0x1.02c9a3e778061p+0}, {0x1.059b0d3158574p+0}, {0x1.0874518759bc8p+0},
      {0x1.0b5586cf9890fp+0}, {0x1.0e3ec32d3d1a2p+0}, {0x1.11301d0125b51p+0}, {0x1.1429aaea92de0p+0},
      {0x1.172b83c7d517bp+0}, {0x1.1a35beb6fcb75p+0}, {0x1.1d4873168b9aap+0}, {0x1.2063b88628cd6p+0},
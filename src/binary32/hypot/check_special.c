@@ -224,5 +224,8 @@ main (int argc, char *argv[])
   printf ("Checking Pythagorean triples\n");
   fflush (stdout);
   doloop(0, 12);
+#ifdef CORE_MATH_STATS
+  cr_stats_dump ();
+#endif
   return 0;
 }
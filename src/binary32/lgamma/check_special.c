@@ -135,5 +135,8 @@ main (int argc, char *argv[])
 
   check_spurious_invalid ();
 
+#ifdef CORE_MATH_STATS
+  cr_stats_dump ();
+#endif
   return 0;
 }
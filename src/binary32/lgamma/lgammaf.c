@@ -29,6 +29,16 @@ SOFTWARE.
 #include <math.h>
 #include <limits.h>
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -77,6 +87,8 @@ static double as_ln(double x){
 }
 
 float cr_lgammaf(float x){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x);
   static const struct {b32u32_u x; float f, df;} tb[] = {
     {{.f = -0x1.efc2a2p+14}, -0x1.222dbcp+18, -0x1p-7},
     {{.f = -0x1.627346p+7}, -0x1.73235ep+9, -0x1p-16},
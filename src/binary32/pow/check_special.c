@@ -301,5 +301,8 @@ main (int argc, char *argv[])
   printf ("Checking exact and midpoint values\n");
   check_exact_or_midpoint ();
 
+#ifdef CORE_MATH_STATS
+  cr_stats_dump ();
+#endif
   return 0;
 }
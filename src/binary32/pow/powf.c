@@ -34,6 +34,16 @@ SOFTWARE.
 #define FLAG_T fexcept_t
 #endif
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -351,8 +361,10 @@ is_exact (float x, float y)
 }
 
 float cr_powf(float x0, float y0){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x0, y0);
   volatile FLAG_T flag = get_flag ();
-  static const double ix[] = {
+  static const double ix[] __attribute__((aligned(64))) = {
     0x1p+0, 0x1.f07c1f07cp-1, 0x1.e1e1e1e1ep-1, 0x1.d41d41d42p-1,
     0x1.c71c71c72p-1, 0x1.bacf914c2p-1, 0x1.af286bca2p-1, 0x1.a41a41a42p-1,
     0x1.99999999ap-1, 0x1.8f9c18f9cp-1, 0x1.861861862p-1, 0x1.7d05f417dp-1,
@@ -363,7 +375,7 @@ float cr_powf(float x0, float y0){
     0x1.111111111p-1, 0x1.0c9714fbdp-1, 0x1.084210842p-1, 0x1.041041041p-1, 0x1p-1
   };
   
-  static const double lix[][2] = {
+  static const double lix[][2] __attribute__((aligned(64))) = {
     {0x0p+0, 0x0p+0}, {-0x1.6cp-5, 0x1.4b229b87f3f89p-15},
     {-0x1.66p-4, -0x1.fb7d654235799p-15}, {-0x1.08p-3, -0x1.8b119b2c9c87bp-12},
     {-0x1.5cp-3, -0x1.a39fa6533294dp-19}, {-0x1.acp-3, -0x1.ebc5b663dd4b8p-12},
@@ -486,7 +498,7 @@ float cr_powf(float x0, float y0){
   static const double ce[] =
     {0x1.62e42fefa398bp-5, 0x1.ebfbdff84555ap-11, 0x1.c6b08d4ad86d3p-17,
      0x1.3b2ad1b1716a2p-23, 0x1.5d7472718ce9dp-30, 0x1.4a1d7f457ac56p-37};
-  static const double tb[] =
+  static const double tb[] __attribute__((aligned(64))) =
     {0x1p+0, 0x1.0b5586cf9890fp+0, 0x1.172b83c7d517bp+0, 0x1.2387a6e756238p+0,
      0x1.306fe0a31b715p+0, 0x1.3dea64c123422p+0, 0x1.4bfdad5362a27p+0, 0x1.5ab07dd485429p+0,
      0x1.6a09e667f3bcdp+0, 0x1.7a11473eb0187p+0, 0x1.8ace5422aa0dbp+0, 0x1.9c49182a3f09p+0,
@@ -519,6 +531,7 @@ float cr_powf(float x0, float y0){
 
 // when is_exact is non-zero, flag is the original inexact flag
 static float as_powf_accurate2(float x0, float y0, int is_exact, FLAG_T flag){
+  CORE_MATH_STAT("as_powf_accurate2");
   static const double o[] = {1, 2};
   static const double ch[][2] =
     {{0x1.71547652b82fep+1, 0x1.777d0ffda2b89p-55}, {0x1.ec709dc3a03fdp-1, 0x1.d27f04ff73b3ap-55},
@@ -27,6 +27,21 @@ SOFTWARE.
 #include <stdint.h>
 #include <errno.h>
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
+/* phase markers of the CORE_MATH_PROFILE builds, see generic/support/profile.h */
+#ifndef CORE_MATH_PHASE
+#define CORE_MATH_PHASE(name)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -75,6 +90,7 @@ typedef unsigned __int128 u128;
 typedef uint64_t u64;
 
 static double __attribute__((noinline)) rbig(uint32_t u, int *q){
+  CORE_MATH_STAT("rbig");
   static const u64 ipi[] = {0xfe5163abdebbc562, 0xdb6295993c439041, 0xfc2757d1f534ddc0, 0xa2f9836e4e441529};
   int e = (u>>23)&0xff, i;
   u64 m = (u&(~0u>>9))|1<<23;
@@ -125,6 +141,7 @@ static inline float add_sign(float x, float rh, float rl){
 }
 
 static void __attribute__((noinline)) as_sincosf_database(float x, float *sout, float *cout){
+  CORE_MATH_STAT("as_sincosf_database");
   static const struct {union{float arg; uint32_t uarg;}; float sh, sl, ch, cl;} st[] = {
     {{0x1.33333p+13}, -0x1.63f4bap-2, -0x1p-27, -0x1.e01216p-1, -0x1p-26},
     {{0x1.75b8a2p-1}, 0x1.55688ap-1, -0x1p-26, 0x1.7d8e1ep-1, 0x1p-26},
@@ -160,6 +177,7 @@ static const double tb[] =
    -0x1.6a09e667f3bcdp-1, -0x1.1c73b39ae68c8p-1, -0x1.87de2a6aea963p-2, -0x1.8f8b83c69a60bp-3};
 
 static void __attribute__((noinline)) as_sincosf_big(float x, float *sout, float *cout){
+  CORE_MATH_STAT("as_sincosf_big");
   b32u32_u t = {.f = x};
   uint32_t ax = t.u<<1;
   if(__builtin_expect(ax>=0xffu<<24, 0)){ // nan or +-inf
@@ -191,6 +209,9 @@ static void __attribute__((noinline)) as_sincosf_big(float x, float *sout, float
 }
 
 void cr_sincosf(float x, float *sout, float *cout){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x);
+  CORE_MATH_PHASE("filter");
   b32u32_u t = {.f = x};
   uint32_t ax = t.u<<1;
   int ia;
@@ -212,17 +233,21 @@ void cr_sincosf(float x, float *sout, float *cout){
       return;
     }
     if(__builtin_expect(ax==0x812d97c8u, 0)) return as_sincosf_database(x, sout, cout);
+    CORE_MATH_PHASE("reduction");
     z = rltl0(z0, &ia);
   } else {
     if (__builtin_expect(ax>0x99000000u, 0)) return as_sincosf_big(x, sout, cout);
     if (__builtin_expect(ax==0x8c333330u, 0)) return as_sincosf_database(x, sout, cout);
+    CORE_MATH_PHASE("reduction");
     z = rltl(z0, &ia);
   }
+  CORE_MATH_PHASE("polynomial");
   double z2 = z*z, z4 = z2*z2;
   double aa = (a[0] + z2*a[1]) + z4*(a[2] + z2*a[3]);
   double bb = (b[0] + z2*b[1]) + z4*(b[2] + z2*b[3]);
   aa *= z;
   bb *= z2;
+  CORE_MATH_PHASE("reconstruction");
   double s0 = tb[ia&31], c0 = tb[(ia+8)&31];
   double rs = s0 + (aa*c0 - bb*s0);
   double rc = c0 - (aa*s0 + bb*c0);
@@ -414,5 +414,9 @@ main (int argc, char *argv[])
 
   check_underflow_before ();
 
-  return doloop();
+  int ret = doloop();
+#ifdef CORE_MATH_STATS
+  cr_stats_dump ();
+#endif
+  return ret;
 }
@@ -521,4 +521,7 @@ main (int argc, char *argv[])
   doloop();
 
   check_signaling_nan ();
+#ifdef CORE_MATH_STATS
+  cr_stats_dump ();
+#endif
 }
@@ -28,6 +28,21 @@ SOFTWARE.
 #include <fenv.h>
 #include <errno.h>
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
+/* phase markers of the CORE_MATH_PROFILE builds, see generic/support/profile.h */
+#ifndef CORE_MATH_PHASE
+#define CORE_MATH_PHASE(name)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -94,6 +109,7 @@ static inline double rltl(float z, int *q){
 // argument reduction
 // same as rltl, but for |x| >= 2^28
 static double __attribute__((noinline)) rbig(uint32_t u, int *q){
+  CORE_MATH_STAT("rbig");
   static const u64 ipi[] = {0xfe5163abdebbc562, 0xdb6295993c439041, 0xfc2757d1f534ddc0, 0xa2f9836e4e441529};
   int e = (u>>23)&0xff, i;
   u64 m = (u&(~0u>>9))|1<<23;
@@ -127,6 +143,9 @@ static double __attribute__((noinline)) rbig(uint32_t u, int *q){
 }
 
 float cr_tanf(float x){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x);
+  CORE_MATH_PHASE("filter");
   b32u32_u t = {.f = x};
   int e = (t.u>>23)&0xff, i;
   double z;
@@ -137,8 +156,10 @@ float cr_tanf(float x){
       float x2 = x*x;
       return __builtin_fmaf(x, 0x1.555556p-2f*x2, x);
     }
+    CORE_MATH_PHASE("reduction");
     z = rltl(x, &i);
   } else if (e<0xff){
+    CORE_MATH_PHASE("reduction");
     z = rbig(t.u, &i);
   } else {
     if(t.u<<9) return x + x; // nan
@@ -148,6 +169,7 @@ float cr_tanf(float x){
     feraiseexcept(FE_INVALID);
     return __builtin_nanf("tinf"); // inf
   }
+  CORE_MATH_PHASE("polynomial");
   double z2 = z*z, z4 = z2*z2;
   static const double cn[] = {0x1.921fb54442d18p+0, -0x1.fd226e573289fp-2, 0x1.b7a60c8dac9f6p-6, -0x1.725beb40f33e5p-13};
   static const double cd[] = {0x1p+0, -0x1.2395347fb829dp+0, 0x1.2313660f29c36p-3, -0x1.9a707ab98d1c1p-9};
@@ -155,8 +177,10 @@ float cr_tanf(float x){
   double n = cn[0] + z2*cn[1], n2 = cn[2] + z2*cn[3]; n += z4*n2;
   double d = cd[0] + z2*cd[1], d2 = cd[2] + z2*cd[3]; d += z4*d2;
   n *= z;
+  CORE_MATH_PHASE("reconstruction");
   double s0 = s[i&1], s1 = s[1-(i&1)];
   double r1 = (n*s1 - d*s0)/(n*s0 + d*s1);
+  CORE_MATH_PHASE("rounding test");
   b64u64_u tr = {.f = r1};
   u64 tail = (tr.u + 7)&(~(uint64_t)0>>35);
   if(__builtin_expect(tail<=14, 0)){
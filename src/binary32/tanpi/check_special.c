@@ -119,5 +119,8 @@ main (int argc, char *argv[])
 
   check_near_overflow ();
 
+#ifdef CORE_MATH_STATS
+  cr_stats_dump ();
+#endif
   return 0;
 }
@@ -29,6 +29,16 @@ SOFTWARE.
 #include <errno.h>
 #include <fenv.h>
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -74,6 +84,8 @@ roundevenf_finite (float x)
 typedef union {float f; uint32_t u;} b32u32_u;
 
 float cr_tanpif(float x){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x);
   b32u32_u ix = {.f = x};
   uint32_t e = ix.u&(0xff<<23);
   if(__builtin_expect(e > (150<<23), 0)){ // |x| > 2^23
@@ -27,6 +27,16 @@ SOFTWARE.
 #include <stdint.h>
 #include <errno.h>
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -124,6 +134,8 @@ static inline double polydd(double xh, double xl, int n, const double c[][2], do
 static double __attribute__((noinline,cold)) as_acos_refine(double, double);
 
 double cr_acos (double x){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x);
   // coefficients of a polynomial approximation of asin(x):
   // asin(x) = x*(cc[j][0] + cc[j][1] + t*P(t, cc[j] + 2))
   // where t = x^2 - j/128
@@ -253,6 +265,7 @@ double cr_acos (double x){
 __attribute__((noinline,cold))
 static
 double as_acos_refine(double x, double phi){
+  CORE_MATH_STAT("as_acos_refine");
   // Consider x as sin(phi) then cos(phi) is ch + cl = sqrt(1-x^2)
   // Using angle rotation formula bring the argument close to zero
   // where the asin Taylor expansion works well.
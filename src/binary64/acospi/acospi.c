@@ -35,6 +35,16 @@ SOFTWARE.
 #include <math.h>
 #include <errno.h>
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -815,6 +825,7 @@ static const int8_t exceptions_rnd[EXCEPTIONS] = {
 static double
 accurate_path (double x)
 {
+  CORE_MATH_STAT ("accurate_path");
   double absx, y, h, l, u, v;
   union_t w;
   const double *p;
@@ -932,6 +943,8 @@ accurate_path (double x)
 double
 cr_acospi (double x)
 {
+  CORE_MATH_STAT ("calls");
+  CORE_MATH_ARGS (x);
   union_t u, v;
   int32_t k;
   u.x = x;
@@ -185,5 +185,8 @@ main (int argc, char *argv[])
     check (x);
   }
 
+#ifdef CORE_MATH_STATS
+  cr_stats_dump ();
+#endif
   return 0;
 }
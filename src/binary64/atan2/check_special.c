@@ -38,6 +38,7 @@ SOFTWARE.
 
 void doloop (int, int);
 extern double cr_atan2 (double, double);
+extern void cr_atan2_array (double *, const double *, const double *, size_t);
 extern int ref_fesetround (int);
 extern void ref_init (void);
 extern mpfr_rnd_t rnd2[];
@@ -235,6 +236,46 @@ check_near_pow2 (void)
   }
 }
 
+/* check cr_atan2_array() gives the same results as cr_atan2(),
+   including when the result array is the y array itself */
+#define ARRAY_SIZE 1021
+static void
+check_array (void)
+{
+  static double y[ARRAY_SIZE], x[ARRAY_SIZE], r[ARRAY_SIZE];
+  struct drand48_data buffer[1];
+  fesetround(rnd1[rnd]);
+  srand48_r (getpid (), buffer);
+  for (int k = 0; k < 100; k++)
+  {
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+      x[i] = get_random (buffer);
+      y[i] = get_random (buffer);
+      if (k & 1) // |y/x| in [2^-64,1]
+      {
+        int ex, ey;
+        frexp (x[i], &ex);
+        frexp (y[i], &ey);
+        y[i] = ldexp (y[i], ex - ey - i % 65);
+      }
+      r[i] = cr_atan2 (y[i], x[i]);
+    }
+    cr_atan2_array (k & 2 ? y : x, y, x, ARRAY_SIZE);
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+      double z = (k & 2) ? y[i] : x[i];
+      if (!is_equal (z, r[i]))
+      {
+        printf ("cr_atan2_array and cr_atan2 differ at index %d\n", i);
+        printf ("cr_atan2_array gives %la\n", z);
+        printf ("cr_atan2       gives %la\n", r[i]);
+        exit (1);
+      }
+    }
+  }
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -286,5 +327,11 @@ main (int argc, char *argv[])
   printf ("Checking random values\n");
   check_random_all ();
 
+  printf ("Checking cr_atan2_array\n");
+  check_array ();
+
+#ifdef CORE_MATH_STATS
+  cr_stats_dump ();
+#endif
   return 0;
 }
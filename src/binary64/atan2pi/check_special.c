@@ -121,6 +121,49 @@ check (double x, double y)
 #define CORE_MATH_TESTS 1000000000ul // total number of tests
 #endif
 
+/* inputs (y,x) for which atan2pi(y,x) is exact, or neither underflows nor
+   overflows, but for which the fast path once raised inexact, underflow or
+   overflow (see also atan2pi.wc) */
+static const double exceptions[][2] = {
+  {0x1p+0, 0x1p+0}, {-0x1p+0, 0x1p+0}, {0x1p+0, -0x1p+0}, {-0x1p+0, -0x1p+0},
+  {0x1.fffffffffffffp+1023, 0x1.fffffffffffffp+1023},
+  {0x1.fffffffffffffp+1023, -0x1.fffffffffffffp+1023},
+  {0x1.63fd573841220p-975, 0x1.b9088860ba560p-937},
+  {0x1.1c42f000ed88ap-953, 0x1.6bec6c771454fp-952},
+  {-0x1.941870decf902p-963, 0x1.834a1fba3641ep-961},
+  {0x1.13d7ea5a3972p+1021, 0x1.f3f9af77d181ep+1021},
+  {0x1.05b8d352037cdp+1021, -0x1.da27262f4bad3p+1021},
+};
+
+/* check no spurious exception is raised for the above inputs: inexact only
+   when |y| <> |x|, and never underflow nor overflow */
+static void
+check_exceptions (void)
+{
+  ref_init ();
+  ref_fesetround (rnd);
+  fesetround (rnd1[rnd]);
+  for (unsigned i = 0; i < sizeof (exceptions) / sizeof (exceptions[0]); i++)
+  {
+    double y = exceptions[i][0], x = exceptions[i][1];
+    check (x, y);
+    feclearexcept (FE_INEXACT | FE_UNDERFLOW | FE_OVERFLOW);
+    double z = cr_atan2pi (y, x);
+    int inex = fetestexcept (FE_INEXACT);
+    int flags = fetestexcept (FE_UNDERFLOW | FE_OVERFLOW);
+    int exact = (y == x || y == -x);
+    if (flags || (exact && inex) || (!exact && !inex))
+    {
+      printf ("Wrong exceptions for y=%la x=%la (z=%la):%s%s%s\n", y, x, z,
+              (flags & FE_UNDERFLOW) ? " underflow" : "",
+              (flags & FE_OVERFLOW) ? " overflow" : "",
+              inex ? " inexact" : " no inexact");
+      fflush (stdout);
+      exit (1);
+    }
+  }
+}
+
 static void
 check_random (int i, int nthreads)
 {
@@ -195,8 +238,14 @@ main (int argc, char *argv[])
         }
     }
 
+  printf ("Checking exceptions\n");
+  check_exceptions ();
+
   printf ("Checking random values\n");
   check_random_all ();
 
+#ifdef CORE_MATH_STATS
+  cr_stats_dump ();
+#endif
   return 0;
 }
@@ -31,6 +31,16 @@ SOFTWARE.
 #include <x86intrin.h>
 #endif
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -113,6 +123,8 @@ typedef union {double f; uint64_t u;} b64u64_u;
 double
 cr_cbrt (double x)
 {
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x);
   static const double escale[3] = {1.0, 0x1.428a2f98d728bp+0/* 2^(1/3) */, 0x1.965fea53d6e3dp+0/* 2^(2/3) */};
   /* the polynomial c0+c1*x+c2*x^2+c3*x^3 approximates x^(1/3) on [1,2]
      with maximal error < 9.2e-5 (attained at x=2) */
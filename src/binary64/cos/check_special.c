@@ -40,6 +40,7 @@ int ref_init (void);
 int ref_fesetround (int);
 
 double cr_cos (double);
+void cr_cos_array (double *, const double *, size_t);
 double ref_cos (double);
 
 int rnd1[] = { FE_TONEAREST, FE_TOWARDZERO, FE_UPWARD, FE_DOWNWARD };
@@ -95,6 +96,41 @@ check (double x)
   }
 }
 
+/* check cr_cos_array() gives the same results as cr_cos(), including when
+   the result array is the input array itself; half of the inputs are
+   close to multiples of pi/2, for which the fast path often fails, so
+   that the queue of the accurate path is filled several times */
+#define ARRAY_SIZE 1021
+static void
+check_array (void)
+{
+  static double x[ARRAY_SIZE], y[ARRAY_SIZE], r[ARRAY_SIZE];
+  fesetround (rnd1[rnd]);
+  for (int k = 0; k < 100; k++)
+  {
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+      if (i & 1)
+        x[i] = get_random (0);
+      else
+        x[i] = (double) (rand_r (Seed) % 1000000) * 0x1.921fb54442d18p+0;
+      r[i] = cr_cos (x[i]);
+    }
+    double *z = (k & 1) ? x : y;
+    cr_cos_array (z, x, ARRAY_SIZE);
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+      if (isnan (z[i]) ? !isnan (r[i]) : asuint64 (z[i]) != asuint64 (r[i]))
+      {
+        printf ("cr_cos_array and cr_cos differ at index %d\n", i);
+        printf ("cr_cos_array gives %la\n", z[i]);
+        printf ("cr_cos       gives %la\n", r[i]);
+        exit (1);
+      }
+    }
+  }
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -164,5 +200,10 @@ main (int argc, char *argv[])
     check (x);
   }
 
+  check_array ();
+
+#ifdef CORE_MATH_STATS
+  cr_stats_dump ();
+#endif
   return 0;
 }
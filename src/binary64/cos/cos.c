@@ -29,8 +29,24 @@ SOFTWARE.
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <stddef.h>
 #include <fenv.h>
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
+/* phase markers of the CORE_MATH_PROFILE builds, see generic/support/profile.h */
+#ifndef CORE_MATH_PHASE
+#define CORE_MATH_PHASE(name)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -1314,7 +1330,7 @@ fast_two_sum(double *hi, double *lo, double a, double b)
    and |xl| < 2^-52.36, with absolute error < 2^-77.09
    (see evalPSfast() in sin.sage).
    Assume uh + ul approximates (xh+xl)^2. */
-static void
+static inline void
 evalPSfast (double *h, double *l, double xh, double xl, double uh, double ul)
 {
   double t;
@@ -1333,7 +1349,7 @@ evalPSfast (double *h, double *l, double xh, double xl, double uh, double ul)
    and |xl| < 2^-52.36, with relative error < 2^-69.96
    (see evalPCfast() in sin.sage).
    Assume uh + ul approximates (xh+xl)^2. */
-static void
+static inline void
 evalPCfast (double *h, double *l, double uh, double ul)
 {
   double t;
@@ -1385,6 +1401,45 @@ evalPC (dint64_t *Y, dint64_t *X2)
   add_dint (Y, Y, PC+0);     // degree 0
 }
 
+/* Number of inputs whose accurate path is evaluated together by
+   cos_accurate_lanes(). */
+#define LANES 4
+
+/* Same as evalPS() for LANES independent inputs: each lane goes through
+   the same operations as in evalPS(), thus gets the same result, but the
+   loop over the lanes is the inner one, so that the multiplications of
+   different lanes, which do not depend on each other, can overlap. */
+static inline void
+evalPS_lanes (dint64_t *Y, dint64_t *X, dint64_t *X2)
+{
+  for (int k = 0; k < LANES; k++)
+    mul_dint_21 (Y + k, X2 + k, PS+5); // degree 11
+  for (int j = 4; j >= 0; j--)         // degrees 9, 7, 5, 3, 1
+  {
+    for (int k = 0; k < LANES; k++)
+      add_dint (Y + k, Y + k, PS+j);
+    for (int k = 0; k < LANES; k++)
+      mul_dint (Y + k, Y + k, j ? X2 + k : X + k);
+  }
+}
+
+/* Same as evalPC() for LANES independent inputs (see evalPS_lanes). */
+static inline void
+evalPC_lanes (dint64_t *Y, dint64_t *X2)
+{
+  for (int k = 0; k < LANES; k++)
+    mul_dint_21 (Y + k, X2 + k, PC+5); // degree 10
+  for (int j = 4; j >= 1; j--)         // degrees 8, 6, 4, 2
+  {
+    for (int k = 0; k < LANES; k++)
+      add_dint (Y + k, Y + k, PC+j);
+    for (int k = 0; k < LANES; k++)
+      mul_dint (Y + k, Y + k, X2 + k);
+  }
+  for (int k = 0; k < LANES; k++)
+    add_dint (Y + k, Y + k, PC+0);     // degree 0
+}
+
 // normalize X such that X->hi has its most significant bit set (if X <> 0)
 static void
 normalize (dint64_t *X)
@@ -1555,7 +1610,7 @@ reduce2 (dint64_t *X)
 }
 
 /* h+l <- c1/2^64 + c0/2^128 */
-static void
+static inline void
 set_dd (double *h, double *l, uint64_t c1, uint64_t c0)
 {
   uint64_t e, f, g;
@@ -1626,7 +1681,7 @@ set_dd (double *h, double *l, uint64_t c1, uint64_t c0)
    Put in err1 a bound for the absolute error:
    | i/2^11 + h + l - frac(x/(2pi)) |.
 */
-static int
+static inline int
 reduce_fast (double *h, double *l, double x, double *err1)
 {
   if (__builtin_expect(x <= 0x1.921fb54442d17p+2, 1)) // x < 2*pi
@@ -1746,12 +1801,13 @@ reduce_fast (double *h, double *l, double x, double *err1)
 /* Assume x is a regular number and x > 0x1.6a09e667f3bccp-27,
    return a bound on the maximal absolute error err:
    | h + l - cos(x) | < err */
-static double
+static inline __attribute__((always_inline)) double
 cos_fast (double *h, double *l, double x)
 {
   int neg = 0, is_cos = 1;
 
   double err1;
+  CORE_MATH_PHASE ("reduction");
   int i = reduce_fast (h, l, x, &err1);
   /* err1 is an absolute bound for | i/2^11 + h + l - frac(x/(2pi)) |:
      | i/2^11 + h + l - frac(x/(2pi)) | < err1 */
@@ -1810,6 +1866,7 @@ cos_fast (double *h, double *l, double x)
   *h -= SC[i][0];
   // now -2^-24 < h < 2^-11+2^-24
   // from reduce_fast() we have |l| < 2^-52.36
+  CORE_MATH_PHASE ("polynomial");
   double uh, ul;
   a_mul (&uh, &ul, *h, *h);
   ul = __builtin_fma (*h + *h, *l, ul);
@@ -1822,6 +1879,7 @@ cos_fast (double *h, double *l, double x)
   /* the relative error of evalPCfast() is less than 2^-69.96 from
      routine evalPCfast(rel=true) in sin.sage:
      | ch + cl - cos(h+l) | < 2^-69.96 * |ch + cl| */
+  CORE_MATH_PHASE ("reconstruction");
   double err;
   if (!is_cos)
     {
@@ -1857,12 +1915,13 @@ cos_fast (double *h, double *l, double x)
   return err + err1;
 }
 
-/* Assume x is a regular number and x > 0x1.6a09e667f3bccp-27. */
-__attribute__((cold))
-static double
-cos_accurate (double x)
+/* First part of the accurate path: put in X the reduced argument, with
+   0 <= X < 2^-11, return the table index i with 0 <= i < 256, and set
+   *neg and *is_cos (see cos_accurate).
+   Assume x is a regular number and x > 0x1.6a09e667f3bccp-27. */
+static inline int
+cos_accurate_reduce (dint64_t *X, int *neg, int *is_cos, double x)
 {
-  dint64_t X[1];
   dint_fromd (X, x);
 
   /* reduce argument */
@@ -1870,14 +1929,15 @@ cos_accurate (double x)
   
   // now |X - x/(2pi) mod 1| < 2^-126.67*X, with 0 <= X < 1.
 
-  int neg = 0, is_cos = 1;
+  *neg = 0;
+  *is_cos = 1;
 
   // Write X = i/2^11 + r with 0 <= r < 2^11.
   int i = reduce2 (X); // exact
 
   if (i & 0x400) // pi <= x < 2*pi: cos(x) = -cos(x-pi)
   {
-    neg = 1;
+    *neg = 1;
     i = i & 0x3ff;
   }
 
@@ -1885,8 +1945,8 @@ cos_accurate (double x)
 
   if (i & 0x200) // pi/2 <= x < pi: cos(x) = -sin(x-pi/2)
   {
-    neg = !neg;
-    is_cos = 0;
+    *neg = !*neg;
+    *is_cos = 0;
     i = i & 0x1ff;
   }
 
@@ -1895,7 +1955,7 @@ cos_accurate (double x)
   if (i & 0x100)
     // pi/4 <= x < pi/2: cos(x) = sin(pi/2-x), sin(x) = cos(pi/2-x)
   {
-    is_cos = !is_cos;
+    *is_cos = !*is_cos;
     X->sgn = 1; // negate X
     add_dint (X, &MAGIC, X); // X -> 2^-11 - X
     // here: 256 <= i <= 511
@@ -1905,6 +1965,59 @@ cos_accurate (double x)
 
   // now 0 <= i < 256 and 0 <= X < 2^-11
 
+  return i;
+}
+
+/* Last part of the accurate path: U approximates cos|x| with the error
+   bound of cos_accurate, return cos(x) rounded, where neg says whether U
+   must be negated. */
+static inline double
+cos_accurate_round (dint64_t *U, int neg, double x)
+{
+  uint64_t err = 41;
+  uint64_t hi0, hi1, lo0, lo1;
+  lo0 = U->lo - err;
+  hi0 = U->hi - (lo0 > U->lo);
+  lo1 = U->lo + err;
+  hi1 = U->hi + (lo1 < U->lo);
+  /* check the upper 54 bits are equal */
+  if ((hi0 >> 10) != (hi1 >> 10))
+    {
+      static const double exceptions[][3] = {
+        {0x1.8000000000009p-23, 0x1.fffffffffff7p-1, 0x1.b56666666666cp-143},
+        {0x1.8000000000024p-22, 0x1.ffffffffffdcp-1, 0x1.b56666666667ep-137},
+        {0x1.800000000009p-21,  0x1.ffffffffff7p-1,  0x1.b5666666666c4p-131},
+        {0x1.20000000000f3p-20, 0x1.fffffffffebcp-1, 0x1.37642666666fdp-127},
+        {0x1.800000000024p-20,  0x1.fffffffffdcp-1,  0x1.b5666666667ddp-125},
+      };
+      for (int k = 0; k < 5; k++)
+        {
+          if (__builtin_fabs (x) == exceptions[k][0])
+            return exceptions[k][1] + exceptions[k][2];
+        }
+      printf ("Rounding test of accurate path failed for cos(%la)\n", x);
+      printf ("Please report the above to core-math@inria.fr\n");
+      exit (1);
+    }
+
+  if (neg)
+    U->sgn = 1 - U->sgn;
+
+  double y = dint_tod (U);
+
+  return y;
+}
+
+/* Assume x is a regular number and x > 0x1.6a09e667f3bccp-27. */
+__attribute__((cold))
+static double
+cos_accurate (double x)
+{
+  CORE_MATH_STAT ("cos_accurate");
+  dint64_t X[1];
+  int neg, is_cos;
+  int i = cos_accurate_reduce (X, &neg, &is_cos, x);
+
   /* If is_cos=1, cos |x| = cos2pi (R * (1 + eps))
         (cases 0 <= x < pi/4 and 3pi/4 <= x < pi)
      if is_cos=0, cos |x| = sin2pi (R * (1 + eps))
@@ -1988,50 +2101,60 @@ cos_accurate (double x)
      The term |U| * 2^-122.650 contributes to at most 2^(128-122.650) < 41 ulps
      relatively to U->lo.
   */
-  uint64_t err = 41;
-  uint64_t hi0, hi1, lo0, lo1;
-  lo0 = U->lo - err;
-  hi0 = U->hi - (lo0 > U->lo);
-  lo1 = U->lo + err;
-  hi1 = U->hi + (lo1 < U->lo);
-  /* check the upper 54 bits are equal */
-  if ((hi0 >> 10) != (hi1 >> 10))
-    {
-      static const double exceptions[][3] = {
-        {0x1.8000000000009p-23, 0x1.fffffffffff7p-1, 0x1.b56666666666cp-143},
-        {0x1.8000000000024p-22, 0x1.ffffffffffdcp-1, 0x1.b56666666667ep-137},
-        {0x1.800000000009p-21,  0x1.ffffffffff7p-1,  0x1.b5666666666c4p-131},
-        {0x1.20000000000f3p-20, 0x1.fffffffffebcp-1, 0x1.37642666666fdp-127},
-        {0x1.800000000024p-20,  0x1.fffffffffdcp-1,  0x1.b5666666667ddp-125},
-      };
-      for (int k = 0; k < 5; k++)
-        {
-          if (__builtin_fabs (x) == exceptions[k][0])
-            return exceptions[k][1] + exceptions[k][2];
-        }
-      printf ("Rounding test of accurate path failed for cos(%la)\n", x);
-      printf ("Please report the above to core-math@inria.fr\n");
-      exit (1);
-    }
-
-  if (neg)
-    U->sgn = 1 - U->sgn;
-
-  double y = dint_tod (U);
+  return cos_accurate_round (U, neg, x);
+}
 
-  return y;
+/* Put in r[k] the value of cos_accurate(x[k]) for 0 <= k < LANES.
+   The argument reductions are done one after the other, then the
+   polynomial evaluations and the reconstructions of all lanes are
+   interleaved. The operations done for each lane are those of
+   cos_accurate(), thus the results are the same.
+   Assume each x[k] is a regular number with x > 0x1.6a09e667f3bccp-27. */
+__attribute__((cold))
+static void
+cos_accurate_lanes (double *r, const double *x)
+{
+  dint64_t X[LANES], X2[LANES], U[LANES], V[LANES];
+  int i[LANES], neg[LANES], is_cos[LANES];
+  for (int k = 0; k < LANES; k++)
+    i[k] = cos_accurate_reduce (X + k, neg + k, is_cos + k, x[k]);
+  for (int k = 0; k < LANES; k++)
+    mul_dint (X2 + k, X + k, X + k);
+  evalPC_lanes (U, X2);
+  evalPS_lanes (V, X, X2);
+  for (int k = 0; k < LANES; k++)
+  {
+    // same as in cos_accurate(), with the tables selected without branch
+    const dint64_t *A = is_cos[k] ? C + i[k] : S + i[k];
+    const dint64_t *B = is_cos[k] ? S + i[k] : C + i[k];
+    mul_dint (U + k, A, U + k);
+    mul_dint (V + k, B, V + k);
+    V[k].sgn ^= is_cos[k]; // negate V if is_cos=1
+  }
+  for (int k = 0; k < LANES; k++)
+    add_dint (U + k, U + k, V + k);
+  for (int k = 0; k < LANES; k++)
+    r[k] = cos_accurate_round (U + k, neg[k], x[k]);
 }
 
-double
-cr_cos (double x)
+/* Return 1 and put cos(x) in *y if x is NaN or Inf, if |x| is tiny, or if
+   the fast path succeeds. Otherwise return 0: then |x| is a regular number
+   with |x| > 0x1.6a09e667f3bccp-27, and cos(x) is cos_accurate(|x|).
+   It is forced inline, like cos_fast(), since it is expanded both in cr_cos()
+   and in the loop of cr_cos_array(): otherwise GCC would keep the fast path
+   out of line in cr_cos(). */
+static inline __attribute__((always_inline)) int
+cos_easy (double *y, double x)
 {
+  CORE_MATH_PHASE ("filter");
   b64u64_u t = {.f = x};
   int e = (t.u >> 52) & 0x7ff;
 
   if (__builtin_expect (e == 0x7ff, 0)) /* NaN, +Inf and -Inf. */
     {
       t.u = ~0ull;
-      return t.f; // return qNaN
+      *y = t.f; // return qNaN
+      return 1;
     }
 
   /* now x is a regular number */
@@ -2050,16 +2173,69 @@ cr_cos (double x)
   */
   t.u &= 0x7fffffffffffffff;
   if (__builtin_expect (t.u <= 0x3e46a09e667f3bcc, 0))
+  {
     // |x| <= 0x1.6a09e667f3bccp-27
-    return __builtin_fma (t.f, -0x1p-28, 1.0);
+    *y = __builtin_fma (t.f, -0x1p-28, 1.0);
+    return 1;
+  }
 
   double h, l, err;
   err = cos_fast (&h, &l, t.f);
+  CORE_MATH_PHASE ("rounding test");
   double left  = h + (l - err), right = h + (l + err);
   /* With SC[] from ./buildSC 15 we get 1100 failures out of 50000000
      random tests, i.e., about 0.002%. */
-  if (__builtin_expect (left == right, 1))
-    return left;
+  *y = left;
+  return left == right;
+}
 
-  return cos_accurate (t.f);
+double
+cr_cos (double x)
+{
+  CORE_MATH_STAT ("calls");
+  CORE_MATH_ARGS (x);
+  double y;
+  if (__builtin_expect (cos_easy (&y, x), 1))
+    return y;
+  return cos_accurate (__builtin_fabs (x));
+}
+
+/* r[j] = cos(x[j]) for 0 <= j < n, with correct rounding.
+   The fast path is inlined in the loop. The inputs for which it fails are
+   queued, and their accurate paths are evaluated LANES at a time by
+   cos_accurate_lanes(), which interleaves the independent multiplications
+   of the different inputs. The result array r may be x itself. */
+void
+cr_cos_array (double *r, const double *x, size_t n)
+{
+  double qx[LANES], qr[LANES];
+  size_t qj[LANES];
+  int q = 0;
+  for (size_t j = 0; j < n; j++)
+  {
+    double y, xj = x[j];
+    if (__builtin_expect (cos_easy (&y, xj), 1))
+    {
+      r[j] = y;
+      continue;
+    }
+    qx[q] = __builtin_fabs (xj);
+    qj[q] = j;
+    if (++q == LANES)
+    {
+      cos_accurate_lanes (qr, qx);
+      for (int k = 0; k < LANES; k++)
+        r[qj[k]] = qr[k];
+      q = 0;
+    }
+  }
+  if (q > 0)
+  {
+    // fill the unused lanes with the first queued input
+    for (int k = q; k < LANES; k++)
+      qx[k] = qx[0];
+    cos_accurate_lanes (qr, qx);
+    for (int k = 0; k < q; k++)
+      r[qj[k]] = qr[k];
+  }
 }
@@ -299,5 +299,8 @@ int main (int argc, char *argv[]){
       }
     }
   }
+#ifdef CORE_MATH_STATS
+  cr_stats_dump ();
+#endif
   return 0;
 }
@@ -26,6 +26,16 @@ SOFTWARE.
 
 #include <stdint.h>
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -331,6 +341,7 @@ cr_erf_fast (double *h, double *l, double z)
 static void
 cr_erf_accurate_tiny (double *h, double *l, double z)
 {
+  CORE_MATH_STAT ("cr_erf_accurate_tiny");
   /* Warning: the following list of exceptional cases should be sorted by
      increasing values. */
   static const double exceptions[][3] = {
@@ -579,6 +590,7 @@ cr_erf_accurate_tiny (double *h, double *l, double z)
 static void
 cr_erf_accurate (double *h, double *l, double z)
 {
+  CORE_MATH_STAT ("cr_erf_accurate");
   static const double exceptions[][3] = {
     {0x1.bc466342a2296p-1, 0x1.8f7ab15eb5babp-1, -0x1.fffffffffffffp-55},
     {0x1.589bbd3ae5489p+0, 0x1.e2d7b84ebf6dbp-1, 0x1.fffffffffffffp-55},
@@ -642,6 +654,8 @@ cr_erf_accurate (double *h, double *l, double z)
 double
 cr_erf (double x)
 {
+  CORE_MATH_STAT ("calls");
+  CORE_MATH_ARGS (x);
   double z = __builtin_fabs (x);
   b64u64_u t = {.f = z};
   uint64_t ux = t.u;
@@ -44,6 +44,16 @@ SOFTWARE.
 #include <errno.h>
 #include <stdint.h>
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -276,6 +286,7 @@ cr_erf_fast (double *h, double *l, double z)
 static void
 cr_erf_accurate_tiny (double *h, double *l, double z)
 {
+  CORE_MATH_STAT ("cr_erf_accurate_tiny");
   /* polynomial generated by erf0_accurate.sollya */
   static const double p[] = {
     0x1.20dd750429b6dp+0, 0x1.1ae3a914fed8p-56,   /* degree 1 */
@@ -386,6 +397,7 @@ __attribute__((cold))
 static void
 cr_erf_accurate (double *h, double *l, double z)
 {
+  CORE_MATH_STAT ("cr_erf_accurate");
   double th, tl;
   if (z < 0.125) /* z < 1/8 */
     return cr_erf_accurate_tiny (h, l, z);
@@ -996,6 +1008,7 @@ static const double Tacc[10][30] = {
 static double
 erfc_asympt_accurate (double x)
 {
+  CORE_MATH_STAT ("erfc_asympt_accurate");
   static const double exceptions[22][3] = {
     {0x1.4a42b163f7a7dp+3, 0x1.183d60a1f7e3cp-158, -0x1.fffffffffffffp-212},
     {0x1.a631d4bc7f56bp+3, 0x1.3f07281bb43aep-256, -0x1p-309},
@@ -1112,6 +1125,7 @@ erfc_asympt_accurate (double x)
 static double
 cr_erfc_accurate (double x)
 {
+  CORE_MATH_STAT ("cr_erfc_accurate");
   double h, l, t;
   if (x < 0)
   {
@@ -1190,6 +1204,8 @@ cr_erfc_accurate (double x)
 double
 cr_erfc (double x)
 {
+  CORE_MATH_STAT ("calls");
+  CORE_MATH_ARGS (x);
   b64u64_u t = {.f = x};
   uint64_t at = t.u & 0x7fffffffffffffff;
 
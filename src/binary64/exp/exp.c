@@ -30,6 +30,21 @@ SOFTWARE.
 #include <x86intrin.h>
 #endif
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
+/* phase markers of the CORE_MATH_PROFILE builds, see generic/support/profile.h */
+#ifndef CORE_MATH_PHASE
+#define CORE_MATH_PHASE(name)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -126,6 +141,7 @@ static inline double as_ldexp(double x, i64 i){
 
 // sets the exponent of a binary64 number to 0 (subnormal range)
 static inline double as_todenormal(double x){
+  CORE_MATH_STAT("as_todenormal");
 #ifdef __x86_64__
     __m128i sb = {~(u64)0>>12, 0};
 #if defined(__clang__)
@@ -163,6 +179,7 @@ static const double db[] = {
 };
 
 static double __attribute__((noinline)) as_exp_database(double x, double f){
+  CORE_MATH_STAT("as_exp_database");
   b64u64_u ix = {.f = x};
   int a = 0, b = sizeof(db)/sizeof(db[0]) - 1, m = (a + b)/2;
   const b64u64_u *c = (const b64u64_u*)db;
@@ -188,7 +205,7 @@ static double __attribute__((noinline)) as_exp_database(double x, double f){
 }
 
 // for 0 <= i < 2^6, t0[i] is a double-double approximation of 2^(i/2^6)
-static const double t0[][2] = {
+static const double t0[][2] __attribute__((aligned(64))) = {
   {0x0p+0, 0x1p+0}, {-0x1.19083535b085ep-56, 0x1.02c9a3e778061p+0},
   {0x1.d73e2a475b466p-55, 0x1.059b0d3158574p+0}, {0x1.186be4bb285p-57, 0x1.0874518759bc8p+0},
   {0x1.8a62e4adc610ap-54, 0x1.0b5586cf9890fp+0}, {0x1.03a1727c57b52p-59, 0x1.0e3ec32d3d1a2p+0},
@@ -224,7 +241,7 @@ static const double t0[][2] = {
 };
 
 // for 0 <= i < 2^6, t1[i] is a double-double approximation of 2^(i/2^12)
-static const double t1[][2] = {
+static const double t1[][2] __attribute__((aligned(64))) = {
   {0x0p+0, 0x1p+0}, {0x1.ae8e38c59c72ap-54, 0x1.000b175effdc7p+0},
   {-0x1.7b5d0d58ea8f4p-58, 0x1.00162f3904052p+0}, {0x1.4115cb6b16a8ep-54, 0x1.0021478e11ce6p+0},
   {-0x1.d7c96f201bb2ep-55, 0x1.002c605e2e8cfp+0}, {0x1.84711d4c35eap-54, 0x1.003779a95f959p+0},
@@ -260,6 +277,7 @@ static const double t1[][2] = {
 };
 
 static double __attribute__((cold,noinline)) as_exp_accurate(double x){
+  CORE_MATH_STAT("as_exp_accurate");
   static const double ch[][2] =
     {{0x1p+0, 0}, {0x1p-1, 0x1.712f72ecec2cfp-99}, {0x1.5555555555555p-3, 0x1.5555555554d07p-57},
      {0x1.5555555555555p-5, 0x1.55194d28275dap-59}, {0x1.1111111111111p-7, 0x1.12faa0e1c0f7bp-63},
@@ -315,6 +333,9 @@ static double __attribute__((cold,noinline)) as_exp_accurate(double x){
 }
 
 double cr_exp(double x){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x);
+  CORE_MATH_PHASE("filter");
   b64u64_u ix = {.f = x};
   u64 aix = ix.u & (~(u64)0>>1);
   // exp(x) rounds to 1 to nearest for |x| <= 0x1p-54
@@ -342,6 +363,7 @@ double cr_exp(double x){
       return 0x1.8p-1022 * 0x1p-55;
     }
   }
+  CORE_MATH_PHASE("reduction");
   const double s = 0x1.71547652b82fep+12;
   double t = roundeven_finite(x*s);
   i64 jt = t, i0 = (jt>>6)&0x3f, i1 = jt&0x3f, ie = jt>>12;
@@ -352,6 +374,7 @@ double cr_exp(double x){
   /* Use Cody-Waite argument reduction: since |x| < 745, we have |t| < 2^23,
      thus since l2h is exactly representable on 29 bits, l2h*t is exact. */
   double dx = (x - l2h*t) + l2l*t, dx2 = dx*dx;
+  CORE_MATH_PHASE("polynomial");
   static const double ch[] = {0x1p+0, 0x1p-1, 0x1.55555557e54ffp-3, 0x1.55555553a12f4p-5};
   double p = (ch[0] + dx*ch[1]) + dx2*(ch[2] + dx*ch[3]);
   double fh = th, tx = th*dx, fl = tl + tx*p;
@@ -369,8 +392,10 @@ double cr_exp(double x){
     if (__builtin_expect(ub != lb, 0)) return as_exp_accurate(x);
     fh = as_todenormal(lb);
   } else {
+    CORE_MATH_PHASE("rounding test");
     double ub = fh + (fl + eps), lb = fh + (fl - eps);
     if(__builtin_expect( ub != lb, 0)) return as_exp_accurate(x);
+    CORE_MATH_PHASE("reconstruction");
     fh = as_ldexp(lb, ie);
   }
   return fh;
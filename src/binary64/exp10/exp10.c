@@ -30,6 +30,16 @@ SOFTWARE.
 #include <x86intrin.h>
 #endif
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -125,6 +135,7 @@ static inline double as_ldexp(double x, i64 i){
 }
 
 static inline double as_todenormal(double x){
+  CORE_MATH_STAT("as_todenormal");
 #ifdef __x86_64__
   __m128i sb = {~(u64)0>>12, 0};
 #if defined(__clang__)
@@ -146,6 +157,7 @@ static inline double as_todenormal(double x){
 }
 
 static double __attribute__((noinline)) as_exp10_database(double x, double f){
+  CORE_MATH_STAT("as_exp10_database");
   static const double db[] = {
     0x1.821e0f2afb97p-11, 0x1.7c3ddd23ac8cap-10, 0x1.a2d7c1699e82dp-10, 0x1.ec65645edc394p-8,
     0x1.90d7373b3a546p-7, 0x1.7e3c84f2cb9b5p-6, 0x1.25765968ecd68p-5, 0x1.9aa6fd4d21a47p-5,
@@ -186,7 +198,7 @@ static double __attribute__((noinline)) as_exp10_database(double x, double f){
   return f;
 }
 
-static const double t0[][2] = {
+static const double t0[][2] __attribute__((aligned(64))) = {
   {0x0p+0, 0x1p+0}, {-0x1.19083535b085ep-56, 0x1.02c9a3e778061p+0},
   {0x1.d73e2a475b466p-55, 0x1.059b0d3158574p+0}, {0x1.186be4bb285p-57, 0x1.0874518759bc8p+0},
   {0x1.8a62e4adc610ap-54, 0x1.0b5586cf9890fp+0}, {0x1.03a1727c57b52p-59, 0x1.0e3ec32d3d1a2p+0},
@@ -221,7 +233,7 @@ static const double t0[][2] = {
   {0x1.9d3e12dd8a18ap-54, 0x1.f50765b6e454p+0}, {0x1.74853f3a5931ep-55, 0x1.fa7c1819e90d8p+0}
 };
 
-static const double t1[][2] = {
+static const double t1[][2] __attribute__((aligned(64))) = {
   {0x0p+0, 0x1p+0}, {0x1.ae8e38c59c72ap-54, 0x1.000b175effdc7p+0},
   {-0x1.7b5d0d58ea8f4p-58, 0x1.00162f3904052p+0}, {0x1.4115cb6b16a8ep-54, 0x1.0021478e11ce6p+0},
   {-0x1.d7c96f201bb2ep-55, 0x1.002c605e2e8cfp+0}, {0x1.84711d4c35eap-54, 0x1.003779a95f959p+0},
@@ -257,6 +269,7 @@ static const double t1[][2] = {
 };
 
 static double __attribute__((noinline)) as_exp10_accurate(double x){
+  CORE_MATH_STAT("as_exp10_accurate");
   static const double c[][2] = {
     {0x1.26bb1bbb55516p+1, -0x1.f48ad494ea102p-53}, {0x1.53524c73cea69p+1, -0x1.e2bfab318d399p-53},
     {0x1.0470591de2ca4p+1, 0x1.81f50779e162bp-53}, {0x1.2bd7609fd98c4p+0, 0x1.31a5cc5d3d313p-54},
@@ -303,6 +316,8 @@ static double __attribute__((noinline)) as_exp10_accurate(double x){
 }
 
 double cr_exp10(double x){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x);
   b64u64_u ix = {.f = x};
   u64 aix = ix.u & (~(u64)0>>1);
   if(__builtin_expect(aix>0x40734413509f79feull, 0)){ // |x| > 0x1.34413509f79fep+8
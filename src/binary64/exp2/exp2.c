@@ -31,6 +31,16 @@ SOFTWARE.
 #include <x86intrin.h>
 #endif
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -134,6 +144,7 @@ static inline double as_ldexp(double x, i64 i){
 // convert x, 2^52 <= x < 2^53 to subnormal range
 // if exact <> 0, raises the underflow exception
 static inline double as_todenormal(double x, int exact){
+  CORE_MATH_STAT("as_todenormal");
 #ifdef __x86_64__
   __m128i sb = {~(u64)0>>12, 0};
 #if defined(__clang__)
@@ -157,6 +168,7 @@ static inline double as_todenormal(double x, int exact){
 }
 
 static __attribute__((noinline)) double as_exp2_database(double x, double f){
+  CORE_MATH_STAT("as_exp2_database");
   static const double db[] = {
     0x1.e4596526bf94dp-10, 0x1.e76049073067fp-10, 0x1.755aa6fa428cdp-9, 0x1.79015ce2843d7p-9,
     0x1.f99afefa30d65p-8, 0x1.8d040898b73f5p-6, 0x1.673a7779d5293p-4, 0x1.8859f5e252908p-4,
@@ -195,7 +207,7 @@ static __attribute__((noinline)) double as_exp2_database(double x, double f){
   return f;
 }
 
-static const double t0[][2] = {
+static const double t0[][2] __attribute__((aligned(64))) = {
   {0x0p+0, 0x1p+0}, {-0x1.19083535b085ep-56, 0x1.02c9a3e778061p+0},
   {0x1.d73e2a475b466p-55, 0x1.059b0d3158574p+0}, {0x1.186be4bb285p-57, 0x1.0874518759bc8p+0},
   {0x1.8a62e4adc610ap-54, 0x1.0b5586cf9890fp+0}, {0x1.03a1727c57b52p-59, 0x1.0e3ec32d3d1a2p+0},
@@ -229,7 +241,7 @@ static const double t0[][2] = {
   {-0x1.e9c23179c2894p-54, 0x1.ea4afa2a490dap+0}, {0x1.dc7f486a4b6bp-54, 0x1.efa1bee615a27p+0},
   {0x1.9d3e12dd8a18ap-54, 0x1.f50765b6e454p+0}, {0x1.74853f3a5931ep-55, 0x1.fa7c1819e90d8p+0}
 };
-static const double t1[][2] = {
+static const double t1[][2] __attribute__((aligned(64))) = {
   {0x0p+0, 0x1p+0}, {0x1.ae8e38c59c72ap-54, 0x1.000b175effdc7p+0},
   {-0x1.7b5d0d58ea8f4p-58, 0x1.00162f3904052p+0}, {0x1.4115cb6b16a8ep-54, 0x1.0021478e11ce6p+0},
   {-0x1.d7c96f201bb2ep-55, 0x1.002c605e2e8cfp+0}, {0x1.84711d4c35eap-54, 0x1.003779a95f959p+0},
@@ -265,6 +277,7 @@ static const double t1[][2] = {
 };
 
 static double __attribute__((cold,noinline)) as_exp2_accurate(double x){
+  CORE_MATH_STAT("as_exp2_accurate");
   b64u64_u ix = {.f = x};
   double sx = 4096.0*x, fx = roundeven_finite(sx), z = sx - fx;
   int64_t k = fx, i1 = k&0x3f, i0 = (k>>6)&0x3f, ie = k>>12;
@@ -317,6 +330,8 @@ static double __attribute__((cold,noinline)) as_exp2_accurate(double x){
 }
 
 double cr_exp2(double x){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x);
   b64u64_u ix = {.f = x};
   u64 ax = ix.u<<1;
   if(__builtin_expect(ax == 0, 0)) return 1.0;
@@ -27,6 +27,16 @@ SOFTWARE.
 #include <stdint.h>
 #include <math.h> // needed to define exp2m1() since glibc does not have it yet
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -144,7 +154,7 @@ static inline void q_1 (double *hi, double *lo, double zh, double zl) {
 /* For 0 <= i < 64, T1[i] = (h,l) such that h+l is the best double-double
    approximation of 2^(i/64). The approximation error is bounded as follows:
    |h + l - 2^(i/64)| < 2^-107. */
-static const double T1[][2] = {
+static const double T1[][2] __attribute__((aligned(64))) = {
     {              0x1p+0,                 0x0p+0},
     {0x1.02c9a3e778061p+0, -0x1.19083535b085dp-56},
     {0x1.059b0d3158574p+0,  0x1.d73e2a475b465p-55},
@@ -214,7 +224,7 @@ static const double T1[][2] = {
 /* For 0 <= i < 64, T2[i] = (h,l) such that h+l is the best double-double
    approximation of 2^(i/2^12). The approximation error is bounded as follows:
    |h + l - 2^(i/2^12)| < 2^-107. */
-static const double T2[][2] = {
+static const double T2[][2] __attribute__((aligned(64))) = {
     {              0x1p+0,                 0x0p+0},
     {0x1.000b175effdc7p+0,  0x1.ae8e38c59c72ap-54},
     {0x1.00162f3904052p+0, -0x1.7b5d0d58ea8f4p-58},
@@ -575,6 +585,7 @@ static const double Q[] = {
 static double
 exp2m1_accurate_tiny (double x)
 {
+  CORE_MATH_STAT ("exp2m1_accurate_tiny");
   /* The following exceptional cases have at least 51 identical bits after
      the round bit, thus are hard to correctly round with double-double
      arithmetic. They should be sorted by increasing values of the first
@@ -703,6 +714,7 @@ exp2m1_accurate_tiny (double x)
 __attribute__((cold))
 static double exp2m1_accurate (double x)
 {
+  CORE_MATH_STAT ("exp2m1_accurate");
   b64u64_u t = {.f = x};
   uint64_t ux = t.u, ax = ux & 0x7fffffffffffffffllu;
 
@@ -841,6 +853,8 @@ static double exp2m1_accurate (double x)
 double
 cr_exp2m1 (double x)
 {
+  CORE_MATH_STAT ("calls");
+  CORE_MATH_ARGS (x);
   b64u64_u t = {.f = x};
   uint64_t ux = t.u, ax = ux & 0x7fffffffffffffffllu;
 
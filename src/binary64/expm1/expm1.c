@@ -30,6 +30,16 @@ SOFTWARE.
 #include <x86intrin.h>
 #endif
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -152,6 +162,7 @@ static const double db[] =
    -0x1.2a9cad9998262p+0, -0x1.e42a2abb1bf0fp+0, };
 
 static double __attribute__((noinline)) as_expm1_database(double x, double f){
+  CORE_MATH_STAT("as_expm1_database");
   b64u64_u ix = {.f = x};
   int a = 0, b = sizeof(db)/sizeof(db[0]) - 1, m = (a + b)/2;
   const b64u64_u *c = (const b64u64_u*)db;
@@ -176,7 +187,7 @@ static double __attribute__((noinline)) as_expm1_database(double x, double f){
   return f;
 }
 
-static const double t0[][2] = {
+static const double t0[][2] __attribute__((aligned(64))) = {
   {0x0p+0, 0x1p+0}, {-0x1.19083535b085ep-56, 0x1.02c9a3e778061p+0},
   {0x1.d73e2a475b466p-55, 0x1.059b0d3158574p+0}, {0x1.186be4bb285p-57, 0x1.0874518759bc8p+0},
   {0x1.8a62e4adc610ap-54, 0x1.0b5586cf9890fp+0}, {0x1.03a1727c57b52p-59, 0x1.0e3ec32d3d1a2p+0},
@@ -211,7 +222,7 @@ static const double t0[][2] = {
   {0x1.9d3e12dd8a18ap-54, 0x1.f50765b6e454p+0}, {0x1.74853f3a5931ep-55, 0x1.fa7c1819e90d8p+0}
 };
 
-static const double t1[][2] = {
+static const double t1[][2] __attribute__((aligned(64))) = {
   {0x0p+0, 0x1p+0}, {0x1.ae8e38c59c72ap-54, 0x1.000b175effdc7p+0},
   {-0x1.7b5d0d58ea8f4p-58, 0x1.00162f3904052p+0}, {0x1.4115cb6b16a8ep-54, 0x1.0021478e11ce6p+0},
   {-0x1.d7c96f201bb2ep-55, 0x1.002c605e2e8cfp+0}, {0x1.84711d4c35eap-54, 0x1.003779a95f959p+0},
@@ -245,7 +256,7 @@ static const double t1[][2] = {
   {0x1.64cbba902ca28p-58, 0x1.029ccf99d720ap+0}, {0x1.4383ef231d206p-54, 0x1.02a803f2d170dp+0},
   {0x1.4a47a505b3a46p-54, 0x1.02b338c811703p+0}, {0x1.e47120223468p-54, 0x1.02be6e199c811p+0},
 };
-static const double tz[][2] = {
+static const double tz[][2] __attribute__((aligned(64))) = {
   {-0x1.797d4686c5393p-57, -0x1.c5041854df7d4p-3}, {-0x1.ea1cb9d163339p-55, -0x1.b881a23aebb48p-3},
   {0x1.f483a3e8cd60fp-55, -0x1.abe60e1f21838p-3}, {0x1.dffd920f493dbp-56, -0x1.9f3129931fabp-3},
   {-0x1.51bfdbb129094p-55, -0x1.9262c1c3430ap-3}, {0x1.cd3e5225e2206p-55, -0x1.857aa375db4e4p-3},
@@ -282,6 +293,7 @@ static const double tz[][2] = {
 };
 
 static double __attribute__((noinline)) as_expm1_accurate(double x){
+  CORE_MATH_STAT("as_expm1_accurate");
   b64u64_u ix = {.f = x};
   if(__builtin_expect(__builtin_fabs(x)<0.25, 0)){
     static const double cl[] =
@@ -355,6 +367,8 @@ static double __attribute__((noinline)) as_expm1_accurate(double x){
 }
 
 double cr_expm1(double x){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x);
   b64u64_u ix = {.f = x};
   u64 aix = ix.u & (~(u64)0>>1);
   if(__builtin_expect(aix < 0x3fd0000000000000ull, 1)){
@@ -480,5 +480,8 @@ main (int argc, char *argv[])
   printf ("Checking near overflow, underflow and Pythagorean triples\n");
   /* we check triples with exponent difference 0 <= k <= 26 */
   doloop(0, 26);
+#ifdef CORE_MATH_STATS
+  cr_stats_dump ();
+#endif
   return 0;
 }
@@ -32,6 +32,16 @@ SOFTWARE.
 #include <x86intrin.h>
 #endif
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -115,6 +125,7 @@ static inline double fasttwosum(double x, double y, double *e){
 }
 
 static double __attribute__((noinline)) as_hypot_denorm(u64 a, u64 b, const fexcept_t flag){
+  CORE_MATH_STAT("as_hypot_denorm");
   double op = 1.0 + 0x1p-54, om = 1.0 - 0x1p-54;
   double af = (i64)a, bf = (i64)b;
   a <<= 1;
@@ -158,6 +169,7 @@ static double __attribute__((noinline)) as_hypot_denorm(u64 a, u64 b, const fexc
    also fits in a 128-bit integer), compared and adjusted if necessary using
    the exact value of x^2+y^2. */
 static double  __attribute__((noinline)) as_hypot_hard(double x, double y, const fexcept_t flag){
+  CORE_MATH_STAT("as_hypot_hard");
   double op = 1.0 + 0x1p-54, om = 1.0 - 0x1p-54;
   b64u64_u xi = {.f = x}, yi = {.f = y};
   u64 bm = (xi.u&(~0ull>>12))|1ll<<52;
@@ -221,6 +233,7 @@ static double  __attribute__((noinline)) as_hypot_hard(double x, double y, const
 
 // case hypot(x,y) >= 2^1024
 static double __attribute__((noinline)) as_hypot_overflow (void){
+  CORE_MATH_STAT("as_hypot_overflow");
   volatile double z = 0x1.fffffffffffffp1023;
   double f = z + z;
 #ifdef CORE_MATH_SUPPORT_ERRNO
@@ -230,6 +243,8 @@ static double __attribute__((noinline)) as_hypot_overflow (void){
 }
 
 double cr_hypot(double x, double y){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x, y);
   volatile fexcept_t flag = get_flags();
   b64u64_u xi = {.f = x}, yi = {.f = y};
   u64 emsk = 0x7ffll<<52, ex = xi.u&emsk, ey = yi.u&emsk;
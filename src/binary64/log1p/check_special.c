@@ -95,6 +95,30 @@ check (double x)
   }
 }
 
+/* inputs for which log1p once raised spurious exceptions: underflow or
+   overflow for huge x, and invalid for a quiet NaN */
+static void
+check_exceptions (void)
+{
+  const double T[] = {
+    0x1p53, 0x1.0000000000001p53, 0x1.fffffffffffffp105, 0x1p106,
+    0x1.238c33ee82983p+1022, 0x1.fffffffffffffp+1023,
+    __builtin_inf (), __builtin_nan (""), -__builtin_nan ("")};
+  for (unsigned i = 0; i < sizeof (T) / sizeof (T[0]); i++)
+  {
+    check (T[i]);
+    feclearexcept (FE_ALL_EXCEPT);
+    double y = cr_log1p (T[i]);
+    int flags = fetestexcept (FE_ALL_EXCEPT & ~FE_INEXACT);
+    if (flags)
+    {
+      printf ("Spurious exception %#x for x=%la (y=%la)\n", flags, T[i], y);
+      fflush (stdout);
+      exit (1);
+    }
+  }
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -139,6 +163,8 @@ main (int argc, char *argv[])
   ref_init ();
   ref_fesetround (rnd);
 
+  check_exceptions ();
+
 #ifndef CORE_MATH_TESTS
 #define CORE_MATH_TESTS 1000000000UL /* total number of tests */
 #endif
@@ -165,5 +191,8 @@ main (int argc, char *argv[])
     check (x);
   }
 
+#ifdef CORE_MATH_STATS
+  cr_stats_dump ();
+#endif
   return 0;
 }
@@ -185,6 +185,29 @@ check_scaled_worst_cases (void)
   free (items);
 }
 
+/* inputs for which log2 must not raise any exception but inexact, in
+   particular not invalid for a quiet NaN (as an ordered comparison would) */
+static void
+check_exceptions (void)
+{
+  const double T[] = {
+    0x1p-1074, 0x1p-1022, 0x1.fffffffffffffp+1023,
+    __builtin_inf (), __builtin_nan (""), -__builtin_nan ("")};
+  for (unsigned i = 0; i < sizeof (T) / sizeof (T[0]); i++)
+  {
+    check (T[i]);
+    feclearexcept (FE_ALL_EXCEPT);
+    double y = cr_log2 (T[i]);
+    int flags = fetestexcept (FE_ALL_EXCEPT & ~FE_INEXACT);
+    if (flags)
+    {
+      printf ("Spurious exception %#x for x=%la (y=%la)\n", flags, T[i], y);
+      fflush (stdout);
+      exit (1);
+    }
+  }
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -229,6 +252,9 @@ main (int argc, char *argv[])
   ref_init ();
   ref_fesetround (rnd);
 
+  printf ("Checking exceptions...\n");
+  check_exceptions ();
+
   printf ("Checking scaled worst cases...\n");
   check_scaled_worst_cases ();
 
@@ -255,5 +281,8 @@ main (int argc, char *argv[])
     check (x);
   }
 
+#ifdef CORE_MATH_STATS
+  cr_stats_dump ();
+#endif
   return 0;
 }
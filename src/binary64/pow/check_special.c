@@ -266,5 +266,8 @@ main (int argc, char *argv[])
   printf ("Checking random values\n");
   check_random_all ();
 
+#ifdef CORE_MATH_STATS
+  cr_stats_dump ();
+#endif
   return 0;
 }
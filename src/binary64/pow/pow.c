@@ -69,6 +69,16 @@ SOFTWARE.
 #define FLAG_T fexcept_t
 #endif
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -1518,6 +1528,8 @@ is_exact (double x, double y)
 
 // Correctly rounded power function
 double cr_pow (double x, double y) {
+  CORE_MATH_STAT ("calls");
+  CORE_MATH_ARGS (x, y);
   double s = 1.0; /* sign of the result */
 
   f64_u _x = {.f = x};
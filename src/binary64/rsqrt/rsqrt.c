@@ -31,6 +31,16 @@ SOFTWARE.
 #include <x86intrin.h>
 #endif
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -94,6 +104,7 @@ typedef int64_t i64;
 typedef union {double f; uint64_t u;} b64u64_u;
 
 static double __attribute__((noinline)) as_rsqrt_refine(double rf, double a){
+  CORE_MATH_STAT("as_rsqrt_refine");
   b64u64_u ir = {.f = rf}, ia = {.f = a};
   if(ia.u < 1ll<<52){
     i64 nz = __builtin_clzll(ia.u);
@@ -143,6 +154,8 @@ static double __attribute__((noinline)) as_rsqrt_refine(double rf, double a){
 }
 
 double cr_rsqrt(double x){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x);
   b64u64_u ix = {.f = x};
   double r;
   if(__builtin_expect(ix.u < 1ll<<52, 0)){ // 0 <= x < 0x1p-1022
@@ -29,10 +29,26 @@ SOFTWARE.
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <stddef.h>
 #include <inttypes.h>
 #include <fenv.h>
 #include <errno.h>
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
+/* phase markers of the CORE_MATH_PROFILE builds, see generic/support/profile.h */
+#ifndef CORE_MATH_PHASE
+#define CORE_MATH_PHASE(name)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -1323,7 +1339,7 @@ fast_two_sum(double *hi, double *lo, double a, double b)
    and |xl| < 2^-52.36, with absolute error < 2^-77.09
    (see evalPSfast() in sin.sage).
    Assume uh + ul approximates (xh+xl)^2. */
-static void
+static inline void
 evalPSfast (double *h, double *l, double xh, double xl, double uh, double ul)
 {
   double t;
@@ -1342,7 +1358,7 @@ evalPSfast (double *h, double *l, double xh, double xl, double uh, double ul)
    and |xl| < 2^-52.36, with relative error < 2^-69.96
    (see evalPCfast() in sin.sage).
    Assume uh + ul approximates (xh+xl)^2. */
-static void
+static inline void
 evalPCfast (double *h, double *l, double uh, double ul)
 {
   double t;
@@ -1394,6 +1410,45 @@ evalPC (dint64_t *Y, dint64_t *X2)
   add_dint (Y, Y, PC+0);     // degree 0
 }
 
+/* Number of inputs whose accurate path is evaluated together by
+   sin_accurate_lanes(). */
+#define LANES 4
+
+/* Same as evalPS() for LANES independent inputs: each lane goes through
+   the same operations as in evalPS(), thus gets the same result, but the
+   loop over the lanes is the inner one, so that the multiplications of
+   different lanes, which do not depend on each other, can overlap. */
+static inline void
+evalPS_lanes (dint64_t *Y, dint64_t *X, dint64_t *X2)
+{
+  for (int k = 0; k < LANES; k++)
+    mul_dint_21 (Y + k, X2 + k, PS+5); // degree 11
+  for (int j = 4; j >= 0; j--)         // degrees 9, 7, 5, 3, 1
+  {
+    for (int k = 0; k < LANES; k++)
+      add_dint (Y + k, Y + k, PS+j);
+    for (int k = 0; k < LANES; k++)
+      mul_dint (Y + k, Y + k, j ? X2 + k : X + k);
+  }
+}
+
+/* Same as evalPC() for LANES independent inputs (see evalPS_lanes). */
+static inline void
+evalPC_lanes (dint64_t *Y, dint64_t *X2)
+{
+  for (int k = 0; k < LANES; k++)
+    mul_dint_21 (Y + k, X2 + k, PC+5); // degree 10
+  for (int j = 4; j >= 1; j--)         // degrees 8, 6, 4, 2
+  {
+    for (int k = 0; k < LANES; k++)
+      add_dint (Y + k, Y + k, PC+j);
+    for (int k = 0; k < LANES; k++)
+      mul_dint (Y + k, Y + k, X2 + k);
+  }
+  for (int k = 0; k < LANES; k++)
+    add_dint (Y + k, Y + k, PC+0);     // degree 0
+}
+
 // normalize X such that X->hi has its most significant bit set (if X <> 0)
 static void
 normalize (dint64_t *X)
@@ -1564,7 +1619,7 @@ reduce2 (dint64_t *X)
 }
 
 /* h+l <- c1/2^64 + c0/2^128 */
-static void
+static inline void
 set_dd (double *h, double *l, uint64_t c1, uint64_t c0)
 {
   uint64_t e, f, g;
@@ -1635,7 +1690,7 @@ set_dd (double *h, double *l, uint64_t c1, uint64_t c0)
    Put in err1 a bound for the absolute error:
    | i/2^11 + h + l - frac(x/(2pi)) |.
 */
-static int
+static inline int
 reduce_fast (double *h, double *l, double x, double *err1)
 {
   if (__builtin_expect(x <= 0x1.921fb54442d17p+2, 1)) // x < 2*pi
@@ -1753,7 +1808,7 @@ reduce_fast (double *h, double *l, double x, double *err1)
 }
 
 /* return the maximal absolute error */
-static double
+static inline __attribute__((always_inline)) double
 sin_fast (double *h, double *l, double x)
 {
   int neg = x < 0, is_sin = 1;
@@ -1761,6 +1816,7 @@ sin_fast (double *h, double *l, double x)
 
   /* now x > 0x1.7137449123ef6p-26 */
   double err1;
+  CORE_MATH_PHASE ("reduction");
   int i = reduce_fast (h, l, absx, &err1);
   /* err1 is an absolute bound for | i/2^11 + h + l - frac(x/(2pi)) |:
      | i/2^11 + h + l - frac(x/(2pi)) | < err1 */
@@ -1818,6 +1874,7 @@ sin_fast (double *h, double *l, double x)
   *h -= SC[i][0];
   // now -2^-24 < h < 2^-11+2^-24
   // from reduce_fast() we have |l| < 2^-52.36
+  CORE_MATH_PHASE ("polynomial");
   double uh, ul;
   a_mul (&uh, &ul, *h, *h);
   ul = __builtin_fma (*h + *h, *l, ul);
@@ -1830,6 +1887,7 @@ sin_fast (double *h, double *l, double x)
   /* the relative error of evalPCfast() is less than 2^-69.96 from
      routine evalPCfast(rel=true) in sin.sage:
      | ch + cl - cos2pi(h+l) | < 2^-69.96 * |ch + cl| */
+  CORE_MATH_PHASE ("reconstruction");
   double err;
   static const double sgn[2] = {1.0, -1.0};
   if (is_sin)
@@ -1865,14 +1923,15 @@ sin_fast (double *h, double *l, double x)
   return err + err1;
 }
 
-/* Assume x is a regular number, and |x| > 0x1.7137449123ef6p-26. */
-__attribute__((cold))
-static double
-sin_accurate (double x)
+/* First part of the accurate path: put in X the reduced argument, with
+   0 <= X < 2^-11, return the table index i with 0 <= i < 256, and set
+   *neg and *is_sin (see sin_accurate).
+   Assume x is a regular number, and |x| > 0x1.7137449123ef6p-26. */
+static inline int
+sin_accurate_reduce (dint64_t *X, int *neg, int *is_sin, double x)
 {
   double absx = (x > 0) ? x : -x;
 
-  dint64_t X[1];
   dint_fromd (X, absx);
 
   /* reduce argument */
@@ -1880,14 +1939,15 @@ sin_accurate (double x)
   
   // now |X - x/(2pi) mod 1| < 2^-126.67*X, with 0 <= X < 1.
 
-  int neg = x < 0, is_sin = 1;
+  *neg = x < 0;
+  *is_sin = 1;
 
   // Write X = i/2^11 + r with 0 <= r < 2^11.
   int i = reduce2 (X); // exact
 
   if (i & 0x400) // pi <= x < 2*pi: sin(x) = -sin(x-pi)
   {
-    neg = !neg;
+    *neg = !*neg;
     i = i & 0x3ff;
   }
 
@@ -1895,7 +1955,7 @@ sin_accurate (double x)
 
   if (i & 0x200) // pi/2 <= x < pi: sin(x) = cos(x-pi/2)
   {
-    is_sin = 0;
+    *is_sin = 0;
     i = i & 0x1ff;
   }
 
@@ -1904,7 +1964,7 @@ sin_accurate (double x)
   if (i & 0x100)
     // pi/4 <= x < pi/2: sin(x) = cos(pi/2-x), cos(x) = sin(pi/2-x)
   {
-    is_sin = !is_sin;
+    *is_sin = !*is_sin;
     X->sgn = 1; // negate X
     add_dint (X, &MAGIC, X); // X -> 2^-11 - X
     // here: 256 <= i <= 511
@@ -1914,6 +1974,59 @@ sin_accurate (double x)
 
   // now 0 <= i < 256 and 0 <= X < 2^-11
 
+  return i;
+}
+
+/* Last part of the accurate path: U approximates sin|x| with the error
+   bound of sin_accurate, return sin(x) rounded, where neg says whether U
+   must be negated. */
+static inline double
+sin_accurate_round (dint64_t *U, int neg, double x)
+{
+  uint64_t err = 41;
+  uint64_t hi0, hi1, lo0, lo1;
+  lo0 = U->lo - err;
+  hi0 = U->hi - (lo0 > U->lo);
+  lo1 = U->lo + err;
+  hi1 = U->hi + (lo1 < U->lo);
+  /* check the upper 54 bits are equal */
+  if ((hi0 >> 10) != (hi1 >> 10))
+    {
+      static const double exceptions[][3] = {
+        {0x1.e0000000001c2p-20, 0x1.dfffffffff02ep-20, 0x1.dcba692492527p-146},
+        /* the following worst case was reported by Erik E., it has 68
+           identical bits after the round bit */
+        {0x1.6ac5b262ca1ffp+849, 0x1p+0, -0x1.2b089ea1e692bp-123},
+      };
+      for (int j = 0; j < 2; j++)
+        {
+          if (__builtin_fabs (x) == exceptions[j][0])
+            return (x > 0) ? exceptions[j][1] + exceptions[j][2]
+              : -exceptions[j][1] - exceptions[j][2];
+        }
+      printf ("Rounding test of accurate path failed for sin(%la)\n", x);
+      printf ("Please report the above to core-math@inria.fr\n");
+      exit (1);
+    }
+
+  if (neg)
+    U->sgn = 1 - U->sgn;
+
+  double y = dint_tod (U);
+
+  return y;
+}
+
+/* Assume x is a regular number, and |x| > 0x1.7137449123ef6p-26. */
+__attribute__((cold))
+static double
+sin_accurate (double x)
+{
+  CORE_MATH_STAT ("sin_accurate");
+  dint64_t X[1];
+  int neg, is_sin;
+  int i = sin_accurate_reduce (X, &neg, &is_sin, x);
+
   /* If is_sin=1, sin |x| = sin2pi (R * (1 + eps))
         (cases 0 <= x < pi/4 and 3pi/4 <= x < pi)
      if is_sin=0, sin |x| = cos2pi (R * (1 + eps))
@@ -1997,50 +2110,60 @@ sin_accurate (double x)
      The term |U| * 2^-122.650 contributes to at most 2^(128-122.650) < 41 ulps
      relatively to U->lo.
   */
-  uint64_t err = 41;
-  uint64_t hi0, hi1, lo0, lo1;
-  lo0 = U->lo - err;
-  hi0 = U->hi - (lo0 > U->lo);
-  lo1 = U->lo + err;
-  hi1 = U->hi + (lo1 < U->lo);
-  /* check the upper 54 bits are equal */
-  if ((hi0 >> 10) != (hi1 >> 10))
-    {
-      static const double exceptions[][3] = {
-        {0x1.e0000000001c2p-20, 0x1.dfffffffff02ep-20, 0x1.dcba692492527p-146},
-        /* the following worst case was reported by Erik E., it has 68
-           identical bits after the round bit */
-        {0x1.6ac5b262ca1ffp+849, 0x1p+0, -0x1.2b089ea1e692bp-123},
-      };
-      for (int j = 0; j < 2; j++)
-        {
-          if (__builtin_fabs (x) == exceptions[j][0])
-            return (x > 0) ? exceptions[j][1] + exceptions[j][2]
-              : -exceptions[j][1] - exceptions[j][2];
-        }
-      printf ("Rounding test of accurate path failed for sin(%la)\n", x);
-      printf ("Please report the above to core-math@inria.fr\n");
-      exit (1);
-    }
-
-  if (neg)
-    U->sgn = 1 - U->sgn;
-
-  double y = dint_tod (U);
+  return sin_accurate_round (U, neg, x);
+}
 
-  return y;
+/* Put in r[k] the value of sin_accurate(x[k]) for 0 <= k < LANES.
+   The argument reductions are done one after the other, then the
+   polynomial evaluations and the reconstructions of all lanes are
+   interleaved. The operations done for each lane are those of
+   sin_accurate(), thus the results are the same.
+   Assume each x[k] is a regular number with |x| > 0x1.7137449123ef6p-26. */
+__attribute__((cold))
+static void
+sin_accurate_lanes (double *r, const double *x)
+{
+  dint64_t X[LANES], X2[LANES], U[LANES], V[LANES];
+  int i[LANES], neg[LANES], is_sin[LANES];
+  for (int k = 0; k < LANES; k++)
+    i[k] = sin_accurate_reduce (X + k, neg + k, is_sin + k, x[k]);
+  for (int k = 0; k < LANES; k++)
+    mul_dint (X2 + k, X + k, X + k);
+  evalPC_lanes (U, X2);
+  evalPS_lanes (V, X, X2);
+  for (int k = 0; k < LANES; k++)
+  {
+    // same as in sin_accurate(), with the tables selected without branch
+    const dint64_t *A = is_sin[k] ? S + i[k] : C + i[k];
+    const dint64_t *B = is_sin[k] ? C + i[k] : S + i[k];
+    mul_dint (U + k, A, U + k);
+    mul_dint (V + k, B, V + k);
+    V[k].sgn ^= !is_sin[k]; // negate V if is_sin=0
+  }
+  for (int k = 0; k < LANES; k++)
+    add_dint (U + k, U + k, V + k);
+  for (int k = 0; k < LANES; k++)
+    r[k] = sin_accurate_round (U + k, neg[k], x[k]);
 }
 
-double
-cr_sin (double x)
+/* Return 1 and put sin(x) in *y if x is NaN or Inf, if |x| is tiny, or if
+   the fast path succeeds. Otherwise return 0: then x is a regular number
+   with |x| > 0x1.7137449123ef6p-26, and sin(x) is sin_accurate(x).
+   It is forced inline, like sin_fast(), since it is expanded both in cr_sin()
+   and in the loop of cr_sin_array(): otherwise GCC would keep the fast path
+   out of line in cr_sin(). */
+static inline __attribute__((always_inline)) int
+sin_easy (double *y, double x)
 {
+  CORE_MATH_PHASE ("filter");
   b64u64_u t = {.f = x};
   int e = (t.u >> 52) & 0x7ff;
 
   if (__builtin_expect (e == 0x7ff, 0)) /* NaN, +Inf and -Inf. */
     {
       t.u = ~0ull;
-      return t.f;
+      *y = t.f;
+      return 1;
     }
 
   /* now x is a regular number */
@@ -2060,7 +2183,10 @@ cr_sin (double x)
   // 0x3e57137449123ef6 = 0x1.7137449123ef6p-26
   if (ux <= 0x3e57137449123ef6) {
     if (x == 0)
-      return x;
+    {
+      *y = x;
+      return 1;
+    }
     // Taylor expansion of sin(x) is x - x^3/6 around zero
     // for x=-0, fma (x, -0x1p-54, x) returns +0
     /* We have underflow when 0 < |x| < 2^-1022 or when |x| = 2^-1022
@@ -2070,16 +2196,67 @@ cr_sin (double x)
     if (__builtin_fabs (x) < 0x1p-1022 || __builtin_fabs (res) < 0x1p-1022)
       errno = ERANGE; // underflow
 #endif
-    return res;
+    *y = res;
+    return 1;
   }
 
   double h, l, err;
   err = sin_fast (&h, &l, x);
+  CORE_MATH_PHASE ("rounding test");
   double left  = h + (l - err), right = h + (l + err);
   /* With SC[] from ./buildSC 15 we get 1100 failures out of 50000000
      random tests, i.e., about 0.002%. */
-  if (__builtin_expect (left == right, 1))
-    return left;
+  *y = left;
+  return left == right;
+}
 
+double
+cr_sin (double x)
+{
+  CORE_MATH_STAT ("calls");
+  CORE_MATH_ARGS (x);
+  double y;
+  if (__builtin_expect (sin_easy (&y, x), 1))
+    return y;
   return sin_accurate (x);
 }
+
+/* r[j] = sin(x[j]) for 0 <= j < n, with correct rounding.
+   The fast path is inlined in the loop. The inputs for which it fails are
+   queued, and their accurate paths are evaluated LANES at a time by
+   sin_accurate_lanes(), which interleaves the independent multiplications
+   of the different inputs. The result array r may be x itself. */
+void
+cr_sin_array (double *r, const double *x, size_t n)
+{
+  double qx[LANES], qr[LANES];
+  size_t qj[LANES];
+  int q = 0;
+  for (size_t j = 0; j < n; j++)
+  {
+    double y, xj = x[j];
+    if (__builtin_expect (sin_easy (&y, xj), 1))
+    {
+      r[j] = y;
+      continue;
+    }
+    qx[q] = xj;
+    qj[q] = j;
+    if (++q == LANES)
+    {
+      sin_accurate_lanes (qr, qx);
+      for (int k = 0; k < LANES; k++)
+        r[qj[k]] = qr[k];
+      q = 0;
+    }
+  }
+  if (q > 0)
+  {
+    // fill the unused lanes with the first queued input
+    for (int k = q; k < LANES; k++)
+      qx[k] = qx[0];
+    sin_accurate_lanes (qr, qx);
+    for (int k = 0; k < q; k++)
+      r[qj[k]] = qr[k];
+  }
+}
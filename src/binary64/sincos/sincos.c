@@ -32,6 +32,16 @@ SOFTWARE.
 #include <inttypes.h>
 #include <fenv.h>
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -1848,6 +1858,7 @@ sincos_fast (double *h, double *l, double *hc, double *lc, double x)
 static double
 sin_accurate (double x)
 {
+  CORE_MATH_STAT ("sin_accurate");
   double absx = (x > 0) ? x : -x;
 
   dint64_t X[1];
@@ -2013,6 +2024,7 @@ sin_accurate (double x)
 static double
 cos_accurate (double x)
 {
+  CORE_MATH_STAT ("cos_accurate");
   dint64_t X[1];
   dint_fromd (X, x);
 
@@ -2176,6 +2188,8 @@ cos_accurate (double x)
 void
 cr_sincos (double x, double *s, double *c)
 {
+  CORE_MATH_STAT ("calls");
+  CORE_MATH_ARGS (x);
   b64u64_u t = {.f = x};
   int e = (t.u >> 52) & 0x7ff;
 
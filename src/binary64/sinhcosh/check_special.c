@@ -0,0 +1,185 @@
+/* Check sinhcosh on random inputs.
+
+Copyright (c) 2022-2024 Paul Zimmermann, Inria.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <fenv.h>
+#include <math.h>
+#include <sys/types.h>
+#include <unistd.h>
+#if (defined(_OPENMP) && !defined(CORE_MATH_NO_OPENMP))
+#include <omp.h>
+#endif
+
+int ref_init (void);
+int ref_fesetround (int);
+
+void cr_sinhcosh (double, double*, double*);
+void ref_sinhcosh (double, double*, double*);
+
+int rnd1[] = { FE_TONEAREST, FE_TOWARDZERO, FE_UPWARD, FE_DOWNWARD };
+
+int rnd = 0;
+int verbose = 0;
+
+#define MAX_THREADS 192
+
+static unsigned int Seed[MAX_THREADS];
+
+static inline uint64_t
+asuint64 (double f)
+{
+  union
+  {
+    double f;
+    uint64_t i;
+  } u = {f};
+  return u.i;
+}
+
+typedef union {double f; uint64_t u;} b64u64_u;
+
+static double
+get_random (int tid)
+{
+  b64u64_u v;
+  v.u = rand_r (Seed + tid);
+  v.u |= (uint64_t) rand_r (Seed + tid) << 31;
+  v.u |= (uint64_t) rand_r (Seed + tid) << 62;
+  return v.f;
+}
+
+static void
+check (double x)
+{
+  int bug;
+  double s1, c1, s2, c2;
+  ref_init ();
+  ref_fesetround (rnd);
+  ref_sinhcosh (x, &s1, &c1);
+  fesetround (rnd1[rnd]);
+  cr_sinhcosh (x, &s2, &c2);
+  if (isnan (s1))
+    bug = !isnan (s2);
+  else if (isnan (s2))
+    bug = !isnan (s1);
+  else
+    bug = asuint64 (s1) != asuint64 (s2);
+  if (bug)
+  {
+    printf ("FAIL x=%la sinh: ref=%la z=%la\n", x, s1, s2);
+    fflush (stdout);
+    exit (1);
+  }
+  if (isnan (c1))
+    bug = !isnan (c2);
+  else if (isnan (c2))
+    bug = !isnan (c1);
+  else
+    bug = asuint64 (c1) != asuint64 (c2);
+  if (bug)
+  {
+    printf ("FAIL x=%la cosh: ref=%la z=%la\n", x, c1, c2);
+    fflush (stdout);
+    exit (1);
+  }
+}
+
+int
+main (int argc, char *argv[])
+{
+  while (argc >= 2)
+    {
+      if (strcmp (argv[1], "--rndn") == 0)
+        {
+          rnd = 0;
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--rndz") == 0)
+        {
+          rnd = 1;
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--rndu") == 0)
+        {
+          rnd = 2;
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--rndd") == 0)
+        {
+          rnd = 3;
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--verbose") == 0)
+        {
+          verbose = 1;
+          argc --;
+          argv ++;
+        }
+      else
+        {
+          fprintf (stderr, "Error, unknown option %s\n", argv[1]);
+          exit (1);
+        }
+    }
+  ref_init ();
+  ref_fesetround (rnd);
+
+#ifndef CORE_MATH_TESTS
+#define CORE_MATH_TESTS 1000000000UL /* total number of tests */
+#endif
+
+  unsigned int seed = getpid ();
+  for (int i = 0; i < MAX_THREADS; i++)
+    Seed[i] = seed + i;
+
+#if (defined(_OPENMP) && !defined(CORE_MATH_NO_OPENMP))
+#pragma omp parallel for
+#endif
+  for (uint64_t n = 0; n < CORE_MATH_TESTS; n++)
+  {
+    int tid;
+#if (defined(_OPENMP) && !defined(CORE_MATH_NO_OPENMP))
+    tid = omp_get_thread_num ();
+#else
+    tid = 0;
+#endif
+    double x;
+    do x = get_random (tid); while (fabs (x) >= 0x1.633ce8fb9f87ep+9);
+    check (x);
+  }
+
+#ifdef CORE_MATH_STATS
+  cr_stats_dump ();
+#endif
+  return 0;
+}
@@ -0,0 +1,66 @@
+/* Correctly rounded hyperbolic sine and cosine for binary64 values.
+
+Copyright (c) 2023 Alexei Sibidanov.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <stdint.h>
+
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
+// Warning: clang also defines __GNUC__
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#endif
+
+#pragma STDC FENV_ACCESS ON
+
+#include "exp_core.h"
+
+/* Put in *s and *c the correctly rounded values of sinh(x) and cosh(x).
+   Both are computed from the same argument reduction and the same
+   approximations of exp(|x|) and exp(-|x|) (see exp_core.h), which costs
+   about the same as one call to cr_sinh or cr_cosh. */
+void cr_sinhcosh(double x, double *s, double *c){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x);
+  b64u64_u ix = {.f = x};
+  u64 aix = ix.u & (~(u64)0>>1);
+  if(__builtin_expect(aix<0x3fd0000000000000ull, 0)){ // |x| < 0x1p-2
+    *s = __cr_sinh_small(x, aix);
+    if(aix<0x3fc0000000000000ull) // |x| < 0x1p-3
+      *c = __cr_cosh_small(x, aix);
+    else
+      __cr_sinhcosh_kernel(0, c, x, 0, 1);
+    return;
+  }
+  __cr_sinhcosh_kernel(s, c, x, 1, 1);
+}
@@ -30,6 +30,16 @@ SOFTWARE.
 #include <fenv.h>
 #include <math.h> // needed to provide sinpi() since glibc does not have it
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -84,6 +94,7 @@ static inline double polydd(double xh, double xl, int n, const double c[][2], do
 }
 
 static double as_sinpi_zero(double x){
+  CORE_MATH_STAT("as_sinpi_zero");
   double x2 = x*x, dx2 = __builtin_fma(x,x,-x2);
   double x3 = x2*x, dx3 = __builtin_fma(x2,x,-x3) + dx2*x;
   static const double ch[][2] = {
@@ -118,6 +129,7 @@ static double as_sinpi_zero(double x){
 }
 
 static double as_sinpi_refine(int iq, double z){
+  CORE_MATH_STAT("as_sinpi_refine");
   double x = z*0x1p-63, x2 = x*x, dx2 = __builtin_fma(x,x,-x2);
   static const double sh[][2] = {
     {0x1.921fb54442d18p+1, 0x1.1a62633145c06p-53}, {-0x1.4abbce625be53p-22, 0x1.05511cbc65743p-76},
@@ -152,6 +164,8 @@ static double as_sinpi_refine(int iq, double z){
 }
 
 double cr_sinpi(double x){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x);
   static const double sn[] = { 0x1.921fb54442d18p-74, -0x1.4abbce625be51p-223, 0x1.466bc6044ba16p-374};
   static const double cn[] = {-0x1.3bd3cc9be45dbp-148, 0x1.03c1f00186416p-298};
   b64u64_u ix = {.f = x};
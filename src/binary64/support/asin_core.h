@@ -0,0 +1,470 @@
+/* Shared kernel for the binary64 arcsine functions.
+
+Copyright (c) 2022-2025 Alexei Sibidanov and Paul Zimmermann.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  The functions asin and asinpi only differ by a final multiplication by
+  1/pi, performed with 128-bit integer arithmetic. They share:
+  - the fast path __cr_asin_fast() below for 2^-26 <= |x| < 1, using the
+    table __cr_asin_s, which can return either an approximation of asin(x)
+    or of asin(x)/pi;
+  - the accurate path __cr_asin_accurate() in asin_core.c;
+  - the final rounding __cr_asin_round().
+  The fast path is inline, while the tables and the accurate path are
+  present only once when both functions are linked together. Each function
+  is responsible for its special values and for |x| < 2^-26. Functions
+  using this kernel need to be linked with asin_core.o.
+*/
+
+#ifndef CORE_MATH_ASIN_CORE_H
+#define CORE_MATH_ASIN_CORE_H
+
+#include <fenv.h>
+#include <stdint.h>
+
+#ifdef __x86_64__
+#include <x86intrin.h>
+#endif
+
+// This code emulates the _mm_getcsr SSE intrinsic by reading the FPCR register.
+// fegetexceptflag accesses the FPSR register, which seems to be much slower
+// than accessing FPCR, so it should be avoided if possible.
+// Adapted from sse2neon: https://github.com/DLTcollab/sse2neon
+#if defined(__aarch64__) || defined(__arm64__) || defined(_M_ARM64)
+#if defined(_MSC_VER)
+#include <arm64intr.h>
+#endif
+
+typedef struct
+{
+  uint16_t res0;
+  uint8_t  res1  : 6;
+  uint8_t  bit22 : 1;
+  uint8_t  bit23 : 1;
+  uint8_t  bit24 : 1;
+  uint8_t  res2  : 7;
+  uint32_t res3;
+} fpcr_bitfield;
+
+inline static unsigned int _mm_getcsr()
+{
+  union
+  {
+    fpcr_bitfield field;
+    uint64_t value;
+  } r;
+
+#if defined(_MSC_VER) && !defined(__clang__)
+  r.value = _ReadStatusReg(ARM64_FPCR);
+#else
+  __asm__ __volatile__("mrs %0, FPCR" : "=r"(r.value));
+#endif
+  static const unsigned int lut[2][2] = {{0x0000, 0x2000}, {0x4000, 0x6000}};
+  return lut[r.field.bit22][r.field.bit23];
+}
+#endif  // defined(__aarch64__) || defined(__arm64__) || defined(_M_ARM64)
+
+static inline int get_rounding_mode (void)
+{
+  /* Warning: on __aarch64__ (for example cfarm103), FE_UPWARD=0x400000
+     instead of 0x800. */
+#if defined(__x86_64__) || defined(__arm64__) || defined(_M_ARM64)
+  const unsigned flagp = _mm_getcsr ();
+  return (flagp&(3<<13))>>3;
+#else
+  return fegetround ();
+#endif
+}
+
+#if (defined(__clang__) && __clang_major__ >= 14) || (defined(__GNUC__) && __GNUC__ >= 14 && __BITINT_MAXWIDTH__ && __BITINT_MAXWIDTH__ >= 128)
+typedef unsigned _BitInt(128) u128;
+typedef _BitInt(128) i128;
+#else
+typedef unsigned __int128 u128;
+typedef __int128 i128;
+#endif
+
+typedef uint64_t u64;
+typedef int64_t i64;
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+typedef union {u128 a; struct {u64 bl, bh;};} u128_u;
+#else
+typedef union {u128 a; struct {u64 bh, bl;};} u128_u;
+#endif
+typedef union {double f; uint64_t u;} b64u64_u;
+
+inline static void shl(u128_u *a, int n){(*a).a <<= n;}
+inline static void shr(u128_u *a, int n){(*a).a >>= n;}
+
+inline static u64 muuh(u64 a, u64 b){return (a*(u128)b)>>64;}
+inline static i64 mh(i64 a, i64 b){return (i64)((a*(i128)b)>>64);}
+inline static i128 imul(i64 a, i64 b){return a*(i128)b;}
+inline static u128 mUU(u128 a, u128 b){
+  u128_u x = {.a = a}, y = {.a = b};
+  u128 o = x.bh*(u128)y.bh;
+  o += (u64)(x.bl*(u128)y.bh>>64);
+  o += (u64)(x.bh*(u128)y.bl>>64);
+  return o;
+}
+
+inline static u128 muU(u64 a, u128 b){
+  u128_u y = {.a = b};
+  u128 o = a*(u128)y.bh;
+  o += a*(u128)y.bl>>64;
+  return o;
+}
+
+inline static u128 sqrU(u128 a){
+  u128_u x = {.a = a};
+  u128 os = x.bl*(u128)x.bh>>63;
+  u128 o = x.bh*(u128)x.bh;
+  return o + os;
+}
+
+
+/* the kernel symbols are internal to the library */
+#if defined(__GNUC__) && defined(__ELF__)
+#define CORE_MATH_HIDDEN __attribute__((visibility("hidden")))
+#else
+#define CORE_MATH_HIDDEN
+#endif
+
+/* INV_PI_H/2+INV_PI_L/2^64 is an approximation by default of 1/pi:
+   INV_PI_H/2+INV_PI_L/2^64 < 1/pi < INV_PI_H/2+(INV_PI_L+1)/2^64 */
+#define INV_PI_H 0x517cc1b727220a94ul
+#define INV_PI_L 0xfe13abe8fa9a6ee0ul
+
+/* multiply fi.a/2^127 by 1/pi */
+inline static void __cr_asin_mul_inv_pi (u128_u *fi){
+  u128 m1 = (u128) INV_PI_H * (u128) fi->bl;
+  u128 m2 = (u128) INV_PI_L * (u128) fi->bh;
+  fi->a = (u128) INV_PI_H * (u128) fi->bh;
+  fi->a += m1 >> 64;
+  fi->a += m2 >> 64;
+}
+
+/* Round to a double, in the rounding mode rm, the approximation fi of
+   asin(|x|) or asin(|x|)/pi with biased exponent e computed by the fast or
+   the accurate path, and give it the sign xsign of x. */
+inline static double __cr_asin_round (u128_u fi, int e, i64 xsign, unsigned rm){
+  int nz = __builtin_clzll(fi.bh);
+  u64 rnd;
+  if(__builtin_expect(rm==FE_TONEAREST, 1)){
+    rnd = (fi.bh>>(10-nz))&1;
+  } else if(rm==FE_DOWNWARD){
+    rnd =  (u64)xsign>>63;
+  } else if(rm==FE_UPWARD){
+    rnd =  ((u64)xsign>>63)^1;
+  } else {
+    rnd = 0;
+  }
+  /* raise the inexact flag */
+  volatile double k0 = 1.0, __attribute__((unused)) k = k0 + 0x1p-1022;
+  b64u64_u t = {.u = ((fi.bh>>(11-nz))+((u64)(e-nz)<<52|rnd))|xsign};
+  return t.f;
+}
+
+/* For 0 <= i <= 64, __cr_asin_s[i] = {s, sh} with
+   s = floor(sin(pi/2*i/64)*2^63), except for i=64 where s = 2^63-1, and
+   sh = round(sin(i*pi/2/64)*2^69) mod 2^64. */
+extern const u64 __cr_asin_s[65][2] CORE_MATH_HIDDEN;
+
+/* Fast path of asin(x) (if pi=0) or asin(x)/pi (if pi=1) for
+   2^-26 <= |x| < 1, where *ex is the exponent e of x, with
+   2^e <= |x| < 2^(e+1) and -26 <= e <= -1, and rm the current rounding mode.
+   If the result can be correctly rounded, put in *r and *ex the arguments
+   fi and e of __cr_asin_round(), and return 1, otherwise return 0, in which
+   case the caller has to use __cr_asin_accurate(). The argument pi should
+   be a constant, so that the corresponding code is removed for asin. */
+static inline int
+__cr_asin_fast (u128_u *r, int *ex, double x, unsigned rm, int pi)
+{
+  /* a[0]...a[3] are approximations of the Taylor coefficients of
+     2^68*asin(x/2^4) at x=0 of order 3, ..., 9. */
+  static const u64 a[] = {0x002aaaaaaaaaaaaa, 0x0000133333333344, 0x0000000b6db6d69d, 0x0000000007c7aa6f};
+  /* b[0]...b[4] are approximations towards zero of the Taylor coefficients of
+     2^84*asin(x/2^6) at x=0 of order 3, ..., 11.
+     The corresponding polynomial has a maximal absolute error
+     less than 2^-82.731 with respect to asin(x)-x over [0,2^-6].
+     Since coefficients are rounded towards zero, and the evaluation is also
+     rounded towards zero (using integer arithmetic), this guarantees the
+     final approximation is a lower bound of asin(x). */
+  static const u64 b[] = {0xaaaaaaaaaaaaaaaa, 0x0004cccccccccccc, 0x0000002db6db6db6, 0x0000000001f1c71c, 0x00000000000016e8};
+  /* pi/2*sqrt(1-x^2)*(ch[0]*x + ch[1]*x^2 + ch[2]*x^3 + ch[3]*x^4) is a rough
+     approximation of 64*acos(x) for 0 <= x <= 1, with error less than 0.056 */
+  static const double ch[] = {0x1.ffb77e06e54aap+5, -0x1.3b200d87cc0fep+5, 0x1.79457faf679e3p+4, -0x1.dc7d5a91dfb7ep+2};
+  b64u64_u t = {.f = x};
+  int e = *ex;
+  u64 sm = (t.u<<11)|(i64)1<<63;
+  /* sm contains in its high 53 bits: the implicit leading bit, and the
+     the 52 explicit bits from the significand, thus |x| = 2^(e+1)*sm/2^64
+     where 2^63 <= sm < 2^64 */
+  u128_u fi;
+  if (e < -6) { /* |x| < 2^-6 */
+    /* now 2^-26 <= |x| < 2^-6 */
+    /* We also have |x| = 2^e*sm/2^63, since e <= -7 we have e+1 <= -6,
+       thus we write |x| = 2^(e+1)*y with y=sm/2^64 */
+    u64 v2 = muuh(sm, sm), v3 = muuh(sm, v2);
+    /* v2 = floor(sm^2/2^64), v3 = floor(sm*v2/2^64) */
+    /* since -26 <= e <= -7, 0 <= -2*e-14 <= 38 thus the shift is valid */
+    v2 >>= -2*e-14;
+    /* v2/2^64 approximates 2^(-2e-14)*y^2: err(v2) <= 1 */
+    /* v3/2^64 approximates y^3: err(v3) <= 2 */
+    u64 d = muuh(v3, b[0] + muuh(v2, b[1] + muuh(v2, b[2] + muuh(v2, b[3] + muuh(v2, b[4])))));
+    /* err(muuh(v2, b[4])) <= 1
+       let c3=muuh(v2, b[4])
+       b[3] + c3 is exact, and does not overflow since c3 < b[4], and
+       b[3]+b[4] < 2^64
+       err(muuh(v2, b[3] + c3)) <= err(v2) + err(muuh(v2, b[4])) + 1
+                                <= 3
+       let c2=muuh(v2,b[3]+c3)
+       b[2] + c2 is exact, and does not overflow since c2 < b[3]+b[4],
+       and b[2]+b[3]+b[4] < 2^64
+       err(muuh(v2, b[2] + c2)) <= 1 + 3 + 1 <= 5
+       let c1=muuh(v2, b[2] + c2)
+       b[1] + c1 is exact, and does not overflow since c1 < b[2]+b[3]+b[4],
+       and b[1]+b[2]+b[3]+b[4] < 2^64
+       err(muuh(v2, b[1] + c1)) <= 1 + 5 + 1 <= 7
+       let c0=muuh(v2, b[1] + c1)
+       b[0] + c0 is exact, and does not overflow since c0 < b[1]+...+b[4],
+       and b[0]+...+b[4] < 2^64
+       err(muuh(v3, b[0] + c0)) <= err(v3) + 7 + 1 <= 10 */
+    /* d/2^64 approximates (up to some power of two) 1/6*x^3 + 3/40*x^5 + ...
+       + 63/2816*x^11 with maximal absolute error:
+       * 2^(84-82.731) < 3 between asin(x)-x and the b[] polynomial
+       * 10/2^64 for the total rounding error in d
+       Thus the total error is bounded by 3+10=13 (which means we can put
+       u.a += 12l<<ss below, since the error is below 13, and the left
+       bound is exact, thus adding 12.999 cannot yield any borrow).
+     */
+    int ss = 63 + 2*e;
+    fi.bl = d<<ss;
+    fi.bh = (d>>(64-ss)) + (sm>>1);
+    /* fi.a/2^127 approximates y + 1/6*y^3 + 3/40*y^5 + ... + 63/2816*y^11 */
+    if (pi)
+    {
+      __cr_asin_mul_inv_pi (&fi);
+      /* now fi.a/2^127 approximates asinpi(x), with error < 15:
+       * 13/pi < 5 coming from the error in the approximation
+         y + 1/6*y^3 + ... which is multiplied by 1/pi
+       * 1 from the error in the approximation of 1/pi which is multiplied
+         by y + 1/6*y^3 + ... < 2 */
+    }
+    int nz = __builtin_clzll (fi.bh) + (rm==FE_TONEAREST);
+    /* the number of leading zeros in fi.bh is usually 1, but it can also
+       be 0, for example for x=0x1.fffffffffffffp-7, thus nz is 0, 1 or 2 */
+    u128_u u = fi;
+    u.a += (pi ? 15ll : 12ll)<<ss;
+    /* Here fi is the 'left' approximation, and u is the 'right' approximation.
+       We check the last bit (or the round bit for FE_TONEAREST) does not
+       change between fi and u. */
+    if( __builtin_expect(((fi.bh^u.bh)>>(11-nz))&1, 0))
+      return 0;
+    e += 0x3ff;
+  } else { /* case |x| >= 2^-6 */
+    double xx = __builtin_fma(x,-x,1.0); /* xx = 1-x^2 */
+    b64u64_u ixx = {.f = 1.0/xx}, c = {.f = __builtin_sqrt (xx)};
+    /* we have xx = (1-x^2)*(1+theta1) with |theta1| < 2^-52
+       thus c = sqrt(1-x^2)*sqrt(1+theta1)*(1+theta2) with |theta2| < 2^-52
+       which can be written:
+       c = sqrt(1-x^2)*(1+theta3)^(3/2) with |theta3| < 2^-52 or:
+       c = sqrt(1-x^2)*(1+theta4) with |theta4| < 2^-51.41
+       thus the absolute error on c is bounded by:
+       |c - sqrt(1-x^2)| < sqrt(1-x^2)*2^51.41 < 2^-51.41.
+       Thus the absolute error on c is bounded by 2^-51.41. */
+    /* ixx ~ 1/(1-x^2), c ~ sqrt(1-x^2) */
+    ixx.f *= c.f;
+    /* ixx approximates 1/sqrt(1-x^2). Let t = o(1/xx) the previous
+       value of ixx. We have t = 1/xx*(1+theta1) with |theta1| < 2^-52,
+       c = sqrt(xx)*(1+theta2) with |theta2| < 2^-52, then
+       ixx = o(t*c) = t*c*(1+theta3) with |theta3| < 2^-52, which yields:
+       ixx = 1/sqrt(xx)*(1+theta1)*(1+theta2)*(1+theta3)
+           = 1/c*(1+theta1)*(1+theta2)^2*(1+theta3)
+       thus |ixx-1/c| < 1/c*|(1+theta1)*(1+theta2)^2*(1+theta3)-1|.
+       The maximal values are attained when all thetaj are +/-2^-52,
+       which yields |ixx-1/c| < 2^-49.9*1/c.
+    */
+    double ax = __builtin_fabs (x), x2 = x*x;
+    double c0 = ch[0] + ax*ch[1];
+    double c2 = ch[2] + ax*ch[3];
+    c0 += x2*c2;
+    /* FIXME: use FMA here: c0 = fma (c0, c.f, 64) */
+    c0 *= c.f;
+    c0 += 64;
+    /* now c0 approximates 64+64*acos(x)/(pi/2), which lies in [64,128] */
+    b64u64_u ic = {.f = c0};
+    int indx = ((ic.u&(~0ull>>12)) + ((i64)1<<(52-7))) >> (52-6);
+    /* indx = round(c0)-64. We have indx < 64 since c0 is decreasing with
+       |x|, thus the largest value is obtained for |x| = 2^-6, and for this
+       value we get c0 = 0x1.fd637111d9943p+6 = 127.347111014276
+       with rounding upwards.
+       Let y=asin(x), i=64-indx, and y[i]=i*pi/2/64, then we have the rotation
+       formula:
+       sin(y-y[i]) = sin(y)*cos(y[i]) - cos(y)*sin(y[i])
+                   = x*cos(y[i]) - sqrt(1-x^2)*sin(y[i])
+       thus:
+       y = y[i] + asin(x*cos(y[i]) - sqrt(1-x^2)*sin(y[i]))
+       where x*cos(y[i]) - sqrt(1-x^2)*sin(y[i]) is small. */
+    u64 cm = (c.u<<11)|(i64)1<<63; int ce = ((i64)c.u>>52) - 0x3ff;
+    /* cm contains in its high bits the 53 significant bits from c,
+       which approximates sqrt(1-x^2), including the implicit bit,
+       ce is the corresponding exponent, such that c = 2^ce*cm/2^63.
+       We now refine the approximation c of sqrt(1-x^2) using one step
+       of Newton's iteration: c += 1/2*e/sqrt(1-x^2) where e = (1-x^2) - c^2.
+       It can be proven (by using the same kind of analysis than in Modern
+       Computer Arithmetic, Lemma 3.7) that if c is an approximation of
+       sqrt(a), and c' = c + 1/2*(a-c^2)/c, then
+       |c'-sqrt(a)| = (sqrt(a)-c)^2/(2c).
+       Here a=1-x^2, and since |c - sqrt(1-x^2)| < 2^-51.41, we get:
+       |c'-sqrt(a)| < 2^-103.82/c. */
+    u128_u sm2 = {.a = (u128)sm * sm}, cm2 = {.a = (u128)cm * cm};
+    /* x^2 = 2^(2*e)*sm2/2^126 and c^2 = 2^(2*ce)*cm2/2^126 */
+    const int off = 36 - 22 + 14;   /* off = 28 */
+    int ss = 128 - 104 + 2*e + off; /* ss = 52 + 2*e */
+    /* for e=-6, ss=40; for x=0x1.fffffffffffffp-1, ss=50 */
+    shl(&sm2, ss);
+    /* now frac(2^50*x^2) = sm2/2^128 */
+    int sc = 128 - 104 + 2*ce + off;
+    if(__builtin_expect(sc>=0, 1))
+      shl(&cm2, sc);
+    else
+      cm2.a >>= -sc; // since sc < 0, the shift by -sc is legitimate
+    /* now frac(2^50*c^2) = cm2/2^128 */
+    sm2.a += cm2.a; /* now frac(2^50*(x^2+c^2)) = sm2/2^128 */
+    /* since |c-sqrt(xx)| < 2^-51.41, we have:
+       |c^2-xx| < 2^-51.41*|c+sqrt(xx)| < 2^-50.41 since c,xx < 1.
+       This proves that |2^50*e| < 2^-0.41 with e = (1-x^2) - c^2.
+       Thus frac(2^50*(x^2+c^2)) is enough to uniquely identify the
+       value of 2^50*(x^2+c^2). */
+    i64 h = sm2.bh;
+    /* h/2^64 approximates 2^50*(x^2+c^2) mod 1, with error bounded by
+       1/2^64 for the truncated part sm2.bl/2^128. */
+    u64 ixm = (ixx.u&(~0ull>>12))|(i64)1<<52; int ixe = ((i64)ixx.u>>52) - 0x3ff;
+    /* ixx = ixm*2^(ixe-52) */
+    /* x*cos(y[i]) - sqrt(1-x^2)*sin(y[i]) is computed as
+       (x-sin(y[i]))*cos(y[i]) - (sqrt(1-x^2)-cos(y[i]))*sin(y[i]) */
+    i64 Smh;
+    ss = 6 + e; /* ss >= 0 */
+    Smh = (sm<<ss) - __cr_asin_s[64-indx][1];
+    /* since |x| = 2^(e+1)*sm/2^64, sm*2^ss = |x|*2^69 */
+    /* now Smh approximates 2^69*(|x|-sin(y[i])) mod 2^64,
+       with maximal error < 0.5 */
+    i64 Cmh;
+    sc = 6 + ce;
+    /* Here ce might be less than -6, and thus sc negative, for example when
+       |x| is very near 1, since sqrt(1-x^2) ~ c^2 = 2^(2*ce)*cm2/2^126.
+       The worst case for |x|=0x1.fffffffffffffp-1 is ce=-26. */
+    if(__builtin_expect(sc>=0,1))
+      Cmh = cm<<sc;
+    else
+      Cmh = cm>>-sc; // since sc < 0, the shift by -sc is legitimate
+    Cmh -= __cr_asin_s[indx][1];
+    /* We now need to add
+       1/2*(1-x^2-c^2)/c to c. Instead we subtract 1/2*h/2^114*ixm*2^(ixe-52),
+       with error bounded by:
+       (a) 2^-103.82/c for the error in Newton's method
+       (b) 1/2/2^114/c for the error on h (neglecting lower order terms)
+       (c) 1/2/2^50*2^-49.9*1/c for the error between ixx and 1/c
+       Altogether we have an error bounded by 2^-100.72*1/c.
+       Since c >= 2^-26 this yields 2^-74.72.
+    */
+    Cmh -= mh(h, ixm)>>(34-ixe);
+    /* now Cmh approximates 2^69*(sqrt(1-x^2)-cos(y[i]))
+       with maximal error 2^69*2^-74.72+0.5 < 0.52 */
+    i64 v = mh(Smh, __cr_asin_s[indx][0]) - mh(Cmh, __cr_asin_s[64-indx][0]), v2 = mh(v, v), v3 = mh(v2, v);
+    /* v approximates 2^68*[(|x|-sin(y[i]))*cos(y[i])
+                            -(sqrt(1-x^2)-cos(y[i]))*sin(y[i])] with error
+       bounded by:
+       1 (truncation error in mh(Smh, __cr_asin_s[indx][0]))
+       +1 (truncation error in mh(Cmh, __cr_asin_s[64-indx][0]))
+       +0.5*0.5=0.25 (error on Smh multiplied by __cr_asin_s[indx][0]/2^64)
+       +0.52*0.5=0.26 (error on Cmh multiplied by __cr_asin_s[64-indx][0])
+       which yields 2.51 neglecting second order terms. */
+    /* the error on v2 is thus bounded by 5.02, and that on v3 by 7.53, still
+       neglecting second order terms */
+    v += mh(v3, a[0] + muuh(v2, a[1] + muuh(v2, a[2] + muuh(v2, a[3]))));
+    /* err(muuh(v2, a[3]) <= 1
+       let c2=muuh(v2, a[3])
+       a[2] + c2 is exact, and does not overflow since c2 < a[3], and
+       a[2]+a[3] < 2^64
+       err(muuh(v2, a[2] + c2)) <= err(v2) + err(muuh(v2, a[3])) + 1
+                                <= 5.02 + 1 + 1 = 7.02
+       let c1=muuh(v2, a[2] + c2)
+       a[1] + c1 is exact, and does not overflow since c1 < a[2]+a[3],
+       and a[2]+a[3] < 2^64
+       err(muuh(v2, a[1] + c1)) <= err(v2) + err(muuh(v2, a[2] + c2)) + 1
+                                <= 5.02 + 7.02 + 1 = 13.04
+       let c0=muuh(v2, a[1] + c1)
+       a[0] + c0 is exact, and does not overflow since c0 < a[1]+a[2]+a[3],
+       and a[1]+a[2]+a[3] < 2^64
+       err(mh(v3, a[0] + c0) <= err(v3) + err(c0) + 1 <= 7.53+13.04+1 = 21.57
+       The total error on v is thus bounded by 2.51 (order 1) + 21.57 (orders
+       3 and more), thus by 24.08.
+     */
+
+    fi.bl = 0xd313198a2e037073;
+    fi.bh = 0x3243f6a8885a308;
+    /* fi.a/2^127 approximates pi/2/64 */
+    fi.a *= (u64)(64u - indx); /* multiply pi/2/64 by i=64-indx */
+    /* we add v after normalization */
+    u64 Vh = v>>5, Vl = v<<59;
+    /* the maximal error 24.08 on v translates into an error of 24.08*2^59
+       on Vl */
+    i128 V = (u128)Vh<<64|Vl;
+    fi.a += V;
+    /* now fi/2^127 approximates asin(|x|) */
+    if (pi)
+    {
+      __cr_asin_mul_inv_pi (&fi);
+      /* now fi.a/2^127 approximates asinpi(|x|), with error < 124*2^55:
+       * 24.08*2^59/pi < 123*2^55 coming from the error in the approximation
+         of asin(|x|) which is multiplied by 1/pi
+       * 1 from the error in the approximation of 1/pi which is multiplied
+         by asin(|x|) */
+    }
+
+    int nz = __builtin_clzll(fi.bh) + (rm==FE_TONEAREST);    
+    u128_u u = fi, d = fi;
+    /* The error is bounded by 24.08*2^59 here, thus by 386*2^55
+       (and by 124*2^55 for asinpi, see above).
+       For reference, the original (non proven) error bounds are:
+       u.a += 50l<<55 and d.a -= 27l<<55. */
+    i64 err = pi ? 124 : 386;
+    u.a += err<<55;
+    d.a -= err<<55;
+    if( __builtin_expect(((d.bh^u.bh)>>(11-nz))&1, 0))
+      return 0;
+    e = 0x3fel;
+  }
+  *r = fi;
+  *ex = e;
+  return 1;
+}
+
+/* Return asin(x) (if pi=0) or asin(x)/pi (if pi=1) correctly rounded,
+   for 2^-26 <= |x| < 1. */
+double __cr_asin_accurate (double x, int pi) CORE_MATH_HIDDEN;
+
+#endif /* CORE_MATH_ASIN_CORE_H */
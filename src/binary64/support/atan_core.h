@@ -0,0 +1,251 @@
+/* Shared kernel for the binary64 inverse tangents.
+
+Copyright (c) 2023-2025 Alexei Sibidanov and Paul Zimmermann.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  The functions atan and atanpi, and atan2 and atan2pi, only differ by
+  a final multiplication by 1/pi. They share:
+  - the argument reduction and polynomial of the fast path of atan
+    (__cr_atan_reduce and __cr_atan_eval below), using the tables __cr_atan_A
+    and __cr_atan_c, and the triple-double refinement __cr_atan_refine();
+  - the fast path of atan2 (__cr_atan2_fast below), using the tables
+    __cr_atan2_F, which can return either atan2(y,x) or atan2(y,x)/pi;
+  - the evaluation __cr_atan_tint() of the rational approximation of atan
+    with 192-bit arithmetic (see tint.h) used by the accurate path of atan2
+    and atan2pi.
+  The fast paths are inline, while the tables and the accurate paths are
+  present only once when several of these functions are linked together.
+  Functions using this kernel need to be linked with atan_core.o.
+*/
+
+#ifndef CORE_MATH_ATAN_CORE_H
+#define CORE_MATH_ATAN_CORE_H
+
+#include <stdint.h>
+
+/* the kernel symbols are internal to the library */
+#if defined(__GNUC__) && defined(__ELF__)
+#define CORE_MATH_HIDDEN __attribute__((visibility("hidden")))
+#else
+#define CORE_MATH_HIDDEN
+#endif
+
+typedef union { double f; uint64_t u; } d64u64;
+
+#include "tint.h"
+
+// ONE_OVER_PIH + ONE_OVER_PIL approximates 1/pi with rel. error < 2^-107.871
+#define ONE_OVER_PIH 0x1.45f306dc9c883p-2
+#define ONE_OVER_PIL -0x1.6b01ec5417056p-56
+
+static inline double fasttwosum(double x, double y, double *e){
+  double s = x + y, z = s - x;
+  *e = y - z;
+  return s;
+}
+
+static inline double fastsum(double xh, double xl, double yh, double yl, double *e){
+  double sl, sh = fasttwosum(xh, yh, &sl);
+  *e = (xl + yl) + sl;
+  return sh;
+}
+
+static inline double adddd(double xh, double xl, double ch, double cl, double *l) {
+  double s = xh + ch, d = s - xh;
+  *l = ((ch - d) + (xh + (d - s))) + (xl + cl);
+  return s;
+}
+
+static inline double muldd(double xh, double xl, double ch, double cl, double *l){
+  double ahlh = ch*xl, alhh = cl*xh, ahhh = ch*xh, ahhl = __builtin_fma(ch, xh, -ahhh);
+  ahhl += alhh + ahlh;
+  ch = ahhh + ahhl;
+  *l = (ahhh - ch) + ahhl;
+  return ch;
+}
+
+/************************** atan and atanpi **************************/
+
+/* __cr_atan_A[i] = {a, b} where a approximates tan(i*pi/256) and
+   b approximates atan(a) - i*pi/256, for 0 <= i <= 128 */
+extern const double __cr_atan_A[129][2] CORE_MATH_HIDDEN;
+
+/* coefficients of the piecewise quadratic approximation of the index
+   of the closest table entry, see __cr_atan_reduce(): each row is padded
+   to 8 bytes so that it lies in one cache line */
+extern const uint16_t __cr_atan_c[31][4] CORE_MATH_HIDDEN;
+
+/* Argument reduction of the fast path of atan, for
+   0x1.b21c475e6362ap-8 <= |x| <= 0x1.2ded8e34a9035p+7, where at encodes |x|.
+   Return h such that atan(x) = ah + al + atan(h) with
+   ah = i*pi/256 (with the sign of x), and al a correction term.
+   For |x| > 0x1.2ded8e34a9035p+7, the caller uses instead
+   ah + al = pi/2 (with the sign of x) and h = -1/x. */
+static inline double
+__cr_atan_reduce (double *ah, double *al, double x, uint64_t at)
+{
+  int64_t i = (at>>51) - 2030l; // 1 <= i <= 30
+  d64u64 t = {.f = x};
+  uint64_t u = t.u & (~(uint64_t)0>>13);
+  uint64_t ut = u>>(51-16), ut2 = ut*ut>>16;
+  i = (((uint64_t)__cr_atan_c[i][0]<<16) + ut*__cr_atan_c[i][1]
+       - ut2*__cr_atan_c[i][2])>>(16+9);
+  double ta = __builtin_copysign(1.0, x)*__cr_atan_A[i][0],
+    id = __builtin_copysign(1.0, x)*(double)i;
+  *al = __builtin_copysign(1.0, x)*__cr_atan_A[i][1] + 0x1.8469898cc517p-55*id;
+  *ah = 0x1.921fb54442dp-7*id;
+  return (x - ta)/(1 + x*ta);
+}
+
+/* Return al + atan(h), where h is the reduced argument from
+   __cr_atan_reduce() (or -1/x for large |x|). The sum ah + al + atan(h)
+   has absolute error bounded by 0x3.fp-52*|h| with respect to atan(x). */
+static inline double
+__cr_atan_eval (double h, double al)
+{
+  static const double ch[] = {0x1p+0, -0x1.555555555552bp-2, 0x1.9999999069c2p-3, -0x1.248d2c8444ac6p-3};
+  double h2 = h*h, h4 = h2*h2;
+  double f = (ch[0] + h2*ch[1]) + h4*(ch[2] + h2*ch[3]);
+  return __builtin_fma(h, f, al);
+}
+
+/* Refinement of atan(x) for 0x1p-27 <= |x|: a is the approximation of
+   atan(x) from the fast path (0x1p-27 <= |a| <= pi/2), used to select
+   the table entry. Put in v0 + v1 + v2 an approximation of atan(x) as a
+   triple-double, with |v1| <= ulp(v0) and |v2| <= ulp(v1). */
+void __cr_atan_refine (double *v0, double *v1, double *v2, double x, double a)
+  CORE_MATH_HIDDEN;
+
+/************************* atan2 and atan2pi *************************/
+
+/* __cr_atan2_F[i] = {l, h} where h + l approximates atan(i/64),
+   for 0 <= i <= 64 */
+extern const double __cr_atan2_F[65][2] CORE_MATH_HIDDEN;
+
+/* Fast path of atan2(y0,x0) (if pi=0) or atan2(y0,x0)/pi (if pi=1), for
+   y0, x0 finite and nonzero. If the result can be correctly rounded, put
+   it in *r and return 1, otherwise return 0, in which case the caller has
+   to use its accurate path. The argument pi should be a constant, so that
+   the corresponding code is removed for atan2. */
+static inline int
+__cr_atan2_fast (double *r, double y0, double x0, int pi)
+{
+  /* O[kw] fits in two cache lines, and is aligned so that O[kw] never
+     straddles them */
+  static const double O[8][2] __attribute__((aligned(64))) = {
+    {0,0}, {0x1.921fb54442d18p+0,0x1.1a62633145c07p-54},
+    {0,0}, {-0x1.921fb54442d18p+0,-0x1.1a62633145c07p-54},
+    {0x1.921fb54442d18p+1,0x1.1a62633145c07p-53}, {0x1.921fb54442d18p+0,0x1.1a62633145c07p-54},
+    {-0x1.921fb54442d18p+1,-0x1.1a62633145c07p-53}, {-0x1.921fb54442d18p+0,-0x1.1a62633145c07p-54}};
+
+  d64u64 iy = {.f = y0}, ix = {.f = x0};
+  uint64_t aiy = iy.u & 0x7fffffffffffffffull, aix = ix.u & 0x7fffffffffffffffull;
+  double ax = __builtin_fabs(x0), ay = __builtin_fabs(y0);
+  double x = __builtin_fmax(ax, ay), y = __builtin_fmin(ax, ay);
+  uint64_t sy = iy.u>>63, sx = ix.u>>63;
+  uint64_t GT = aix<aiy;
+  uint64_t dxy = (aix-aiy)^-GT;
+  if(__builtin_expect( dxy>=53ull<<52, 0)) return 0;
+  d64u64 sgn = {.u = (GT^sx^sy)<<63}; /* +0 or -0 */
+  uint64_t kw = sx<<2|sy<<1|GT;
+  d64u64 jj = {.f = y/x + (2 + 1/128.)};
+  int64_t jt = ((jj.u>>(52-7))&127);
+  double fh = __cr_atan2_F[jt][1]*__builtin_copysign(1,sgn.f);
+  double fl = __cr_atan2_F[jt][0]*__builtin_copysign(1,sgn.f);
+  fh += O[kw][0];
+  fl += O[kw][1];
+  if(__builtin_expect(x<0x1p-968, 0)){x *= 0x1p968; y *= 0x1p968;}
+  if(__builtin_expect(x>0x1p1022, 0)){
+    if(__builtin_expect(jt != 0,1)){
+      x *= 0x1p-1; y *= 0x1p-1;
+    }
+  }
+  /* t0 = jt/64, obtained from jj by truncation (exact) */
+  d64u64 tj = {.u = jj.u & ~(((uint64_t) 1 << (52-7)) - 1)};
+  double t0 = tj.f - 2;
+  double zn = __builtin_fma(-t0,x,y), zd = __builtin_fma(t0,y,x);
+  double z = zn/zd;
+  static const double b[] = {-0x1.55555555554d2p-2, 0x1.999999860e1cap-3, -0x1.248ad469844a1p-3};
+  double z2 = z*z;
+  z *= __builtin_copysign(1,sgn.f);
+  double dz = (z*z2)*(b[0] + z2*(b[1] + z2*b[2]));
+  // this bound is obtained with 1.1e10 random argument pairs in the roundup mode;
+  // the obtained maximal difference is increased by 2.5% for safety
+  double eps = __builtin_fabs(z)*0x1.051p-51 + 0x1p-90;
+  double rh = fasttwosum(fh, z, &z);
+  double rl = (fl + dz) + z;
+  if (pi) {
+    /* We normalize rh + rl so that |rl| <= ulp(rh), then the rounding
+       errors of muldd() together with the error on 1/pi are bounded by
+       2^-100*|rh|. The absolute error eps on atan2(y0,x0) becomes
+       eps/pi < eps*0x1.46p-2 after the multiplication by 1/pi. */
+    rh = fasttwosum(rh, rl, &rl);
+    rh = muldd(rh, rl, ONE_OVER_PIH, ONE_OVER_PIL, &rl);
+    eps = eps*0x1.46p-2 + 0x1p-98*__builtin_fabs(rh);
+  }
+  double lb = rh + (rl - eps), ub = rh + (rl + eps);
+  if(lb!=ub){
+    double dh = y*t0, dl = __builtin_fma(y,t0,-dh), e;
+    dh = fasttwosum(x, dh, &e);
+    double rdh = 1/dh;
+    dl += e;
+    double nh = x*t0, nl = __builtin_fma(x,t0,-nh);
+    double dt = y-nh, y1 = dt+nh;
+    if( __builtin_expect(y1 == y, 1)){
+      nh = fasttwosum(dt, -nl, &nl);
+    } else {
+      nh = fasttwosum(dt, (y - y1) - nl, &nl);
+    }
+    double zh = nh * rdh;
+    z2 = zh*zh;
+    double zl = rdh * (__builtin_fma(dh, -zh, nh) + (nl - (nh*rdh)*dl));
+    static const double b2[] =
+      {-0x1.5555555555555p-2, 0x1.999999999755ep-3, -0x1.24924883596f8p-3, 0x1.c6f7d73531bc2p-4};
+    zl += zh*z2*((b2[0] + z2*b2[1]) + (z2*z2)*(b2[2] + z2*b2[3]));
+    zh *= __builtin_copysign(1,sgn.f);
+    zl *= __builtin_copysign(1,sgn.f);
+    eps = 0x1.4p-50*(__builtin_fabs(zh)*z2 + 0x1p-51);
+    fh = fastsum(fh,fl,zh,zl,&fl);
+    if (pi) { // same analysis as above
+      fh = fasttwosum(fh, fl, &fl);
+      fh = muldd(fh, fl, ONE_OVER_PIH, ONE_OVER_PIL, &fl);
+      eps = eps*0x1.46p-2 + 0x1p-98*__builtin_fabs(fh);
+    }
+    lb = fh + (fl - eps);
+    ub = fh + (fl + eps);
+    if(lb!=ub)
+      return 0;
+  }
+  *r = ub;
+  return 1;
+}
+
+/* Put in z an approximation of atan(z) for 0 < z <= 1, using a rational
+   approximation z*P(z)/Q(z) of atan(z) with relative error < 3.99613e-59.
+   The relative error of the result with respect to atan(z_in) is bounded
+   by 2^-182.90 (see atan2.c for the details). */
+void __cr_atan_tint (tint_t *z) CORE_MATH_HIDDEN;
+
+#endif
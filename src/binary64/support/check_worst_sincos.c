@@ -459,4 +459,7 @@ main (int argc, char *argv[])
   check_signaling_nan ();
 
   doloop();
+#ifdef CORE_MATH_STATS
+  cr_stats_dump ();
+#endif
 }
@@ -1,4 +1,4 @@
-/* Correctly-rounded power function for two binary64 values.
+/* Double-int arithmetic for the accurate phase of the binary64 logarithms.
 
 Copyright (c) 2022 CERN.
 Author: Tom Hubrecht
@@ -16,7 +16,7 @@ furnished to do so, subject to the following conditions:
 The above copyright notice and this permission notice shall be included in all
 copies or substantial portions of the Software.
 
-THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, exp_dRESS OR
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
 IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
 FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
 AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
@@ -30,8 +30,12 @@ SOFTWARE.
   data type used in the second iteration of Ziv's method. It is composed of two
   uint64_t values for the significand and the exponent is represented by a
   signed int64_t value.
-*/
 
+  It used to be copied in each of log, log10, log1p, log10p1 and log2p1.
+  The approximation tables of the accurate logarithm now live in log_core.c,
+  so that they are present only once when several of these functions are
+  linked together.
+*/
 #ifndef DINT_H
 #define DINT_H
 
@@ -46,18 +50,29 @@ SOFTWARE.
 #ifndef UINT128_T
 #define UINT128_T
 
+#if (defined(__clang__) && __clang_major__ >= 14) || (defined(__GNUC__) && __GNUC__ >= 14 && __BITINT_MAXWIDTH__ && __BITINT_MAXWIDTH__ >= 128)
+typedef unsigned _BitInt(128) u128;
+#else
 typedef unsigned __int128 u128;
+#endif
 
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
 typedef union {
   u128 r;
   struct {
-#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
-    uint64_t l, h;
+    uint64_t l;
+    uint64_t h;
+  };
+} uint128_t;
 #else
-    uint64_t h, l;
-#endif
+typedef union {
+  u128 r;
+  struct {
+    uint64_t h;
+    uint64_t l;
   };
 } uint128_t;
+#endif
 
 // Add two 128 bit integers and return 1 if an overflow occured
 static inline int addu_128(uint128_t a, uint128_t b, uint128_t *r) {
@@ -102,7 +117,7 @@ static const dint64_t M_ONE = {
     .hi = 0x8000000000000000, .lo = 0x0, .ex = 0, .sgn = 0x1};
 
 /* the following is an approximation of log(2), with absolute error less
-   than 2^-129.97: |(hi/2^63+lo/2^127)*2^-1 - log(2)| < 2^-129.97 */
+   than 2^-129.97 */
 static const dint64_t LOG2 = {
     .hi = 0xb17217f7d1cf79ab, .lo = 0xc9e3b39803f2f6af, .ex = -1, .sgn = 0x0};
 
@@ -111,6 +126,11 @@ static const dint64_t LOG2 = {
 static const dint64_t LOG2_INV = {
     .hi = 0xb8aa3b295c17f0bb, .lo = 0xbe87fed0691d3e89, .ex = 12, .sgn = 0x0};
 
+/* the following is an approximation of 1/log(10), with absolute error less
+   than 2^-131.02: |(hi/2^63+lo/2^127)*2^-2 - 1/log(10)| < 2^-131.02 */
+static const dint64_t LOG10_INV = {
+    .hi = 0xde5bd8a937287195, .lo = 0x355baaafad33dc32, .ex = -2, .sgn = 0x0};
+
 static const dint64_t ZERO = {.hi = 0x0, .lo = 0x0, .ex = 0, .sgn = 0x0};
 
 /*
@@ -287,6 +307,35 @@ static inline void dint_fromd(dint64_t *a, double b) {
   a->lo = 0;
 }
 
+// Convert a dint64_t value to a double
+// assuming the input is not in the subnormal range
+static inline double dint_tod(dint64_t *a) {
+
+  f64_u r = {.u = (a->hi >> 11) | (0x3ffll << 52)};
+  /* r contains the upper 53 bits of a->hi, 1 <= r < 2 */
+
+  double rd = 0.0;
+  /* if round bit is 1, add 2^-53 */
+  if ((a->hi >> 10) & 0x1)
+    rd += 0x1p-53;
+
+  /* if trailing bits after the rounding bit are non zero, add 2^-54 */
+  if (a->hi & 0x3ff || a->lo)
+    rd += 0x1p-54;
+
+  r.u = r.u | a->sgn << 63;
+  r.f += (a->sgn == 0) ? rd : -rd;
+
+  f64_u e;
+
+  /* For the logarithms, the result is always in the normal range,
+     thus a->ex > -1023. Similarly, we cannot have a->ex > 1023. */
+
+  e.u = ((a->ex + 1023) & 0x7ff) << 52;
+
+  return r.f * e.f;
+}
+
 // Prints a dint64_t value for debugging purposes
 static inline void print_dint(const dint64_t *a) {
   printf("{.hi=0x%"PRIx64", .lo=0x%"PRIx64", .ex=%"PRId64", .sgn=0x%"PRIx64"}\n", a->hi, a->lo, a->ex,
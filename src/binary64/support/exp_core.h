@@ -0,0 +1,290 @@
+/* Shared exponential kernel for the binary64 hyperbolic functions.
+
+Copyright (c) 2023 Alexei Sibidanov.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  The functions sinh, cosh and tanh reduce their argument in the same way,
+  writing k*log(2)/2^12 = (2^12*e + 2^6*i0 + i1)*log(2)/2^12 close to |x|
+  (or to -2|x| for tanh). They share:
+  - the tables __cr_exp_t0 and __cr_exp_t1, where __cr_exp_t0[i0] and
+    __cr_exp_t1[i1] approximate 2^(i0/2^6) and 2^(i1/2^12) as double-doubles
+    (low part first);
+  - the accurate evaluation __cr_exp_accurate() of exp(x).
+  Moreover sinh and cosh evaluate exp(|x|) and exp(-|x|) and only differ by
+  the way both are combined: __cr_sinhcosh_kernel() below does it for sinh,
+  for cosh, or for both at once (as cr_sinhcosh does) from a single argument
+  reduction, a single table lookup and, when needed, a single accurate
+  evaluation of each exponential. The paths for small |x| are inline too.
+  The tables, the accurate path, the accurate paths for small |x| and the
+  databases of exceptions of sinh and cosh are present only once in
+  exp_core.c. Functions using this kernel need to be linked with exp_core.o.
+*/
+
+#ifndef CORE_MATH_EXP_CORE_H
+#define CORE_MATH_EXP_CORE_H
+
+#include <stdint.h>
+#include <errno.h>
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+typedef uint64_t u64;
+typedef union {double f; u64 u;} b64u64_u;
+
+/* the kernel symbols are internal to the library */
+#if defined(__GNUC__) && defined(__ELF__)
+#define CORE_MATH_HIDDEN __attribute__((visibility("hidden")))
+#else
+#define CORE_MATH_HIDDEN
+#endif
+
+static inline double fasttwosum(double x, double y, double *e){
+  double s = x + y, z = s - x;
+  *e = y - z;
+  return s;
+}
+
+static inline double muldd(double xh, double xl, double ch, double cl, double *l){
+  double ahlh = ch*xl, alhh = cl*xh, ahhh = ch*xh, ahhl = __builtin_fma(ch, xh, -ahhh);
+  ahhl += alhh + ahlh;
+  ch = ahhh + ahhl;
+  *l = (ahhh - ch) + ahhl;
+  return ch;
+}
+
+static inline double mulddd(double xh, double xl, double ch, double *l){
+  double ahlh = ch*xl, ahhh = ch*xh, ahhl = __builtin_fma(ch, xh, -ahhh);
+  ahhl += ahlh;
+  ch = ahhh + ahhl;
+  *l = (ahhh - ch) + ahhl;
+  return ch;
+}
+
+static inline double polydd(double xh, double xl, int n, const double c[][2], double *l){
+  int i = n-1;
+  double ch = c[i][0] + *l, cl = ((c[i][0] - ch) + *l) + c[i][1];
+  while(--i>=0){
+    ch = muldd(xh, xl, ch, cl, &cl);
+    double th = ch + c[i][0], tl = (c[i][0] - th) + ch;
+    ch = th;
+    cl += tl + c[i][1];
+  }
+  *l = cl;
+  return ch;
+}
+
+/* __cr_exp_t0[i] approximates 2^(i/2^6) and __cr_exp_t1[i] approximates
+   2^(i/2^12), for 0 <= i < 64, as double-doubles: t[i][1] + t[i][0] */
+extern const double __cr_exp_t0[64][2] CORE_MATH_HIDDEN;
+extern const double __cr_exp_t1[64][2] CORE_MATH_HIDDEN;
+
+/* Accurate evaluation of exp(x), where th + tl approximates 2^(t/2^12)
+   (possibly scaled by a power of 2) from the tables above:
+   return vh and set *l to vl such that vh + vl approximates
+   (th + tl)*exp(x - t*log(2)/2^12). */
+double __cr_exp_accurate (double x, double t, double th, double tl, double *l)
+  CORE_MATH_HIDDEN;
+
+/* Accurate paths of sinh and cosh for small |x|. */
+double __cr_sinh_zero (double x) CORE_MATH_HIDDEN;
+double __cr_cosh_zero (double x) CORE_MATH_HIDDEN;
+
+/* Accurate path of sinh and cosh for |x| >= 0x1p-3: put in *rs (resp. *rc)
+   the correctly rounded value of sinh(x) (resp. cosh(x)), unless rs (resp.
+   rc) is NULL. */
+void __cr_sinhcosh_accurate (double *rs, double *rc, double x)
+  CORE_MATH_HIDDEN;
+
+/* sinh(x) for |x| < 0x1p-2, where aix is the encoding of |x| */
+static inline double __cr_sinh_small (double x, u64 aix){
+  if(__builtin_expect(aix<0x3e57137449123ef7ull, 0)) {
+    // |x| < 0x1.7137449123ef7p-26
+    /* We have underflow exactly when 0 < |x| < 2^-1022:
+       for RNDU, sinh(2^-1022-2^-1074) would round to 2^-1022-2^-1075
+       with unbounded exponent range */
+#ifdef CORE_MATH_SUPPORT_ERRNO
+    if (x != 0 && __builtin_fabs (x) < 0x1p-1022)
+      errno = ERANGE; // underflow
+#endif
+    return __builtin_fma(x,0x1p-55,x);
+  }
+  static const double c[] =
+    {0x1.5555555555555p-3, 0x1.1111111111087p-7, 0x1.a01a01a12e1c3p-13, 0x1.71de2e415aa36p-19, 0x1.aed2bff4269e6p-26};
+  double x2 = x*x, x3 = x2*x, x4 = x2*x2, p = x3*((c[0] + x2*c[1]) + x4*((c[2] + x2*c[3]) + x4*c[4]));
+  double e = x3*0x1.9p-53, lb = x + (p - e), ub = x + (p + e);
+  if(lb == ub) return lb;
+  return __cr_sinh_zero(x);
+}
+
+/* cosh(x) for |x| < 0x1p-3, where aix is the encoding of |x| */
+static inline double __cr_cosh_small (double x, u64 aix){
+  if(__builtin_expect(aix<0x3e50000000000000ull, 0)) return __builtin_fma(__builtin_fabs(x),0x1p-55,1);
+  static const double c[] = {
+    0x1p-1, 0x1.555555555554ep-5, 0x1.6c16c16c26737p-10, 0x1.a019ffbbcdbdap-16, 0x1.27ffe2df106cbp-22};
+  double x2 = x*x, x4 = x2*x2, p = x2*((c[0] + x2*c[1]) + x4*((c[2] + x2*c[3]) + x4*c[4]));
+  double e = x2*(4*0x1p-53), lb = 1 + (p - e), ub = 1 + (p + e);
+  if(lb == ub) return lb;
+  return __cr_cosh_zero(x);
+}
+
+/* Final rounding of sinh(x) (resp. cosh(x)) from the accurate approximation
+   rh + rl of sinh(|x|) (resp. cosh(x)). */
+/* Call __cr_sinhcosh_accurate() through local variables, so that the
+   addresses of the results of the fast path do not escape (which would
+   force them to memory). */
+static inline void
+__cr_sinhcosh_slow (double *rs, double *rc, double x, int todo_s, int todo_c)
+{
+  double s, c;
+  __cr_sinhcosh_accurate(todo_s ? &s : 0, todo_c ? &c : 0, x);
+  if(todo_s) *rs = s;
+  if(todo_c) *rc = c;
+}
+
+/*
+  Put in *rs the correctly rounded value of sinh(x) if do_sinh is non-zero,
+  and in *rc the one of cosh(x) if do_cosh is non-zero, including for
+  infinities, NaN and overflow. The callers pass constant values of do_sinh
+  and do_cosh, so that only the code needed is kept. The identities
+  sinh(x)=(exp(|x|)-exp(-|x|))/2*copysign(1,x) and
+  cosh(x)=(exp(|x|)+exp(-|x|))/2 are used, which requires |x| >= 0x1p-2
+  for sinh and |x| >= 0x1p-3 for cosh. For |x|<5 both exponents are
+  calculated with slightly higher precision than double. For
+  5<|x|<36.736801 the exp(-|x|) is small and is calculated with double
+  precision but exp(|x|) is calculated with higher than double precision.
+  For 36.736801<|x|<710.47586 exp(-|x|) becomes too small and only exp(|x|)
+  is calculated. When the rounding test fails, __cr_sinhcosh_accurate() is
+  called out of line, so that no value of the fast path needs to be kept
+  across a call.
+*/
+static inline void
+__cr_sinhcosh_kernel (double *rs, double *rc, double x, int do_sinh,
+                      int do_cosh)
+{
+  const double s = 0x1.71547652b82fep+12;
+  double ax = __builtin_fabs(x), v0 = __builtin_fma(ax, s, 0x1.8000002p+26);
+  b64u64_u jt = {.f = v0};
+#if defined(__x86_64__)
+  __m128d v = _mm_set_sd (v0);
+  __m128i tt = {~((1<<26)-1l),0};
+  v = _mm_and_pd(v,(__m128d)tt);
+  double t = v[0] - 0x1.8p26;
+#else
+  b64u64_u v = {.f = v0};
+  uint64_t tt = ~((1<<26)-1l);
+  v.u &= tt;
+  double t = v.f - 0x1.8p26;
+#endif
+  b64u64_u ix = {.f = ax};
+  u64 aix = ix.u;
+  int64_t il = ((int64_t)jt.u<<14)>>40, jl = -il;
+  int64_t i1 = il&0x3f, i0 = (il>>6)&0x3f, ie = il>>12;
+  int64_t j1 = jl&0x3f, j0 = (jl>>6)&0x3f, je = jl>>12;
+  b64u64_u sp = {.u = (1022 + ie)<<52}, sm = {.u = (1022 + je)<<52};
+  double t0h = __cr_exp_t0[i0][1], t0l = __cr_exp_t0[i0][0];
+  double t1h = __cr_exp_t1[i1][1], t1l = __cr_exp_t1[i1][0];
+  double th = t0h*t1h, tl = t0h*t1l + t1h*t0l + __builtin_fma(t0h,t1h,-th);
+  const double l2h = 0x1.62e42ffp-13, l2l = 0x1.718432a1b0e26p-47;
+  double dx = (ax - l2h*t) + l2l*t, dx2 = dx*dx, mx = -dx;
+  static const double ch[] = {0x1p+0, 0x1p-1, 0x1.5555555aaaaaep-3, 0x1.55555551c98cp-5};
+  double pp = dx*((ch[0] + dx*ch[1]) + dx2*(ch[2] + dx*ch[3]));
+  double sgn = __builtin_copysign(1, x);
+  // todo_s (resp. todo_c) is set when the fast path of sinh (resp. cosh) fails
+  int todo_s = 0, todo_c = 0;
+  if(__builtin_expect(aix>0x4014000000000000ull, 0)){ // |x| > 5
+    if(__builtin_expect(aix>0x40425e4f7b2737faull, 0)){ // |x| >~ 36.736801
+      if(__builtin_expect(aix>0x408633ce8fb9f87dull, 0)){ // |x| >~ 710.47586
+	if(aix>=0x7ff0000000000000ull){ // +-inf or nan
+	  if(do_sinh) *rs = x + x;
+	  if(do_cosh) *rc = (aix>0x7ff0000000000000ull) ? x + x : ax;
+	  return;
+	}
+#ifdef CORE_MATH_SUPPORT_ERRNO
+	errno = ERANGE;
+#endif
+	if(do_sinh) *rs = __builtin_copysign(0x1p1023, x)*2.0;
+	if(do_cosh) *rc = 0x1p1023*2.0;
+	return;
+      }
+      sp.u = (1021 + ie)<<52;
+      double rh = th, rl = tl + th*pp, e = 0.11e-18*th;
+      if(do_sinh){
+	double lb = rh*sgn + (rl*sgn - e), ub = rh*sgn + (rl*sgn + e);
+	if(lb == ub) *rs = (lb*sp.f)*2; else todo_s = 1;
+      }
+      if(do_cosh){
+	double lb = rh + (rl - e), ub = rh + (rl + e);
+	if(lb == ub) *rc = (lb*sp.f)*2; else todo_c = 1;
+      }
+      if(__builtin_expect(todo_s|todo_c, 0))
+	__cr_sinhcosh_slow(rs, rc, x, todo_s, todo_c);
+      return;
+    }
+    double q0h = __cr_exp_t0[j0][1], q1h = __cr_exp_t1[j1][1], qh = q0h*q1h;
+    th *= sp.f;
+    tl *= sp.f;
+    qh *= sm.f;
+    double pm = mx*((ch[0] + mx*ch[1]) + dx2*(ch[2] + mx*ch[3]));
+    double em = qh + qh*pm, e = 0.09e-18*th;
+    if(do_sinh){
+      double rh = th*sgn, rl = ((tl - em) + th*pp)*sgn;
+      double lb = rh + (rl - e), ub = rh + (rl + e);
+      if(lb == ub) *rs = lb; else todo_s = 1;
+    }
+    if(do_cosh){
+      double rh = th, rl = (tl + em) + th*pp;
+      double lb = rh + (rl - e), ub = rh + (rl + e);
+      if(lb == ub) *rc = lb; else todo_c = 1;
+    }
+  } else {
+    double q0h = __cr_exp_t0[j0][1], q0l = __cr_exp_t0[j0][0];
+    double q1h = __cr_exp_t1[j1][1], q1l = __cr_exp_t1[j1][0];
+    double qh = q0h*q1h, ql = q0h*q1l + q1h*q0l + __builtin_fma(q0h,q1h,-qh);
+    th *= sp.f;
+    tl *= sp.f;
+    qh *= sm.f;
+    ql *= sm.f;
+    double pm = mx*((ch[0] + mx*ch[1]) + dx2*(ch[2] + mx*ch[3]));
+    double fph = th, fpl = tl + th*pp;
+    double fmh = qh, fml = ql + qh*pm;
+    if(do_sinh){
+      double rh = fph - fmh, rl = ((fph - rh) - fmh) - fml + fpl;
+      rh *= sgn;
+      rl *= sgn;
+      double e = 0.28e-18*rh, lb = rh + (rl - e), ub = rh + (rl + e);
+      if(lb == ub) *rs = lb; else todo_s = 1;
+    }
+    if(do_cosh){
+      double rh = fph + fmh, rl = ((fph - rh) + fmh) + fml + fpl;
+      double e = 0.28e-18*rh, lb = rh + (rl - e), ub = rh + (rl + e);
+      if(lb == ub) *rc = lb; else todo_c = 1;
+    }
+  }
+  if(__builtin_expect(todo_s|todo_c, 0))
+    __cr_sinhcosh_slow(rs, rc, x, todo_s, todo_c);
+}
+
+#endif /* CORE_MATH_EXP_CORE_H */
@@ -0,0 +1,377 @@
+/* Shared kernel for the binary64 logarithms.
+
+Copyright (c) 2022-2025 INRIA and CERN.
+Authors: Paul Zimmermann and Tom Hubrecht.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  The functions log, log2, log10, log1p, log2p1 and log10p1 only differ by
+  the final scaling (by 1, 1/log(2) or 1/log(10)) and by the reconstruction
+  of 1+x. They share:
+  - the fast path below, which computes log(x) or log(1+x) as a
+    double-double, using the table __cr_log_tab;
+  - the accurate path __cr_log_accurate() and __cr_log1p_accurate()
+    in log_core.c, which computes log(x) or log(1+x) with about 122 bits
+    of accuracy using dint64_t arithmetic (see dint.h), and its batched
+    form __cr_log_accurate_lanes();
+  - for log1p, the accurate path __cr_log1p_accurate_small() for
+    |x| < 0.0625, in log_core.c.
+  The fast path is inline, so that each function keeps its own (short)
+  code, while the tables and the accurate path are present only once when
+  several of these functions are linked together.
+
+  Each function is responsible for its special values, its exact cases,
+  its hard-to-round cases, for scaling the result of the kernel, and for
+  the corresponding error analysis. Functions using this kernel need to be
+  linked with log_core.o.
+*/
+
+#ifndef CORE_MATH_LOG_CORE_H
+#define CORE_MATH_LOG_CORE_H
+
+#include <stdint.h>
+#include "dint.h"
+
+/* the kernel symbols are internal to the library */
+#if defined(__GNUC__) && defined(__ELF__)
+#define CORE_MATH_HIDDEN __attribute__((visibility("hidden")))
+#else
+#define CORE_MATH_HIDDEN
+#endif
+
+typedef union { double f; uint64_t u; } d64u64;
+
+/* Add a + b, such that *hi + *lo approximates a + b.
+   Assumes |a| >= |b|.  */
+static inline void
+fast_two_sum (double *hi, double *lo, double a, double b)
+{
+  double e;
+
+  *hi = a + b;
+  e = *hi - a; /* exact */
+  *lo = b - e; /* exact */
+  /* Now hi + lo = a + b exactly for rounding to nearest.
+     For directed rounding modes, this is not always true.
+     Take for example a = 1, b = 2^-200, and rounding up,
+     then hi = 1 + 2^-52, e = 2^-52 (it can be proven that
+     e is always exact), and lo = -2^52 + 2^-105, thus
+     hi + lo = 1 + 2^-105 <> a + b = 1 + 2^-200.
+     A bound on the error is given
+     in "Note on FastTwoSum with Directed Roundings"
+     by Paul Zimmermann, https://hal.inria.fr/hal-03798376, 2022.
+     Theorem 1 says that
+     the difference between a+b and hi+lo is bounded by 2u^2|a+b|
+     and also by 2u^2|hi|. Here u=2^-53, thus we get:
+     |(a+b)-(hi+lo)| <= 2^-105 min(|a+b|,|hi|) */
+}
+
+// Multiply exactly a and b, such that *hi + *lo = a * b.
+static inline void a_mul(double *hi, double *lo, double a, double b) {
+  *hi = a * b;
+  *lo = __builtin_fma(a, b, -*hi);
+}
+
+// Multiply a double with a double double : a * (bh + bl)
+static inline void s_mul (double *hi, double *lo, double a, double bh,
+                          double bl) {
+  double s;
+
+  a_mul (hi, &s, a, bh); /* exact */
+  *lo = __builtin_fma (a, bl, s);
+}
+
+/* Returns (ah + al) * (bh + bl) - (al * bl).
+   This decomposes into:
+   a_mul (hi, l1, ah, bh) [exact]
+   l2 = __builtin_fma (ah, bl, l1)
+   lo = __builtin_fma (al, bh, l2) */
+static inline void d_mul(double *hi, double *lo, double ah, double al,
+                         double bh, double bl) {
+  a_mul (hi, lo, ah, bh);
+  *lo = __builtin_fma (ah, bl, *lo);
+  *lo = __builtin_fma (al, bh, *lo);
+}
+
+/* For 362 <= i <= 724, __cr_log_tab[i-362] = {r, h, l, 0} where r = r[i]
+   is a 10-bit approximation of 1/x[i], where i*2^-9 <= x[i] < (i+1)*2^-9,
+   such that r[i]*y-1 is representable exactly on 53 bits for any y,
+   i*2^-9 <= y < (i+1)*2^-9, and |r[i]*y-1| <= 0.00212097167968735,
+   and (h,l) is a double-double approximation of -log(r[i]), with h an
+   integer multiple of 2^-42, and |l| < 2^-43. The maximal difference between
+   -log(r[i]) and h+l is bounded by 2^-97. Each row lies in one cache line
+   (see log_core.c). */
+extern const double __cr_log_tab[363][4] CORE_MATH_HIDDEN;
+
+/* The following is a degree-6 polynomial generated by Sollya over
+   [-0.00202941894531250,0.00212097167968735],
+   with absolute error < 2^-70.278.
+   The polynomial is P[0]*x + P[1]*x^2 + ... + P[5]*x^6.
+   The algorithm assumes that P[0]=1. */
+static const double __cr_log_P[6] = {0x1p0,                 /* degree 1 */
+                                     -0x1.ffffffffffffap-2, /* degree 2 */
+                                     0x1.555555554f4d8p-2,  /* degree 3 */
+                                     -0x1.0000000537df6p-2, /* degree 4 */
+                                     0x1.999a14758b084p-3,  /* degree 5 */
+                                     -0x1.55362255e0f63p-3, /* degree 6 */
+};
+
+/* Given 1 <= y < 2, where y = v.f, put in h+l a double-double approximation
+   of log(2^e*y), with absolute error bounded by 2^-68.22 (details below).
+   We have |h| < 745 and |l| < 2^-18.69.
+*/
+static inline void
+__cr_log_fast (double *h, double *l, int e, d64u64 v)
+{
+  const double *P = __cr_log_P;
+  uint64_t m = 0x10000000000000 + (v.u & 0xfffffffffffff);
+  /* y = m/2^52 */
+  /* if y > sqrt(2), we divide it by 2 to avoid cancellation */
+  int c = m >= 0x16a09e667f3bcd;
+  e += c; /* now -1074 <= e <= 1024 */
+  /* i = m >> (43 + c) and y = v.f/2^c are computed without loading from
+     small tables, which would each take an extra cache line */
+  int i = m >> (43 + c);
+  d64u64 w = {.u = v.u - ((uint64_t) c << 52)};
+  double y = w.f;
+#define OFFSET 362
+  const double *t = __cr_log_tab[i - OFFSET];
+#undef OFFSET
+  double r = t[0];
+  double l1 = t[1];
+  double l2 = t[2];
+  double z = __builtin_fma (r, y, -1.0); /* exact */
+  /* evaluate P(z), for |z| < 0.00212097167968735 */
+  double ph; /* will hold the value of P(z)-z */
+  double z2 = z * z; /* |z2| < 4.5e-6 thus the rounding error on z2 is
+                        bounded by ulp(4.5e-6) = 2^-70. */
+  double p45 = __builtin_fma (P[5], z, P[4]);
+  /* |P[5]| < 0.167, |z| < 0.0022, |P[4]| < 0.21 thus |p45| < 0.22:
+     the rounding (and total) error on p45 is bounded by ulp(0.22) = 2^-55 */
+  double p23 = __builtin_fma (P[3], z, P[2]);
+  /* |P[3]| < 0.26, |z| < 0.0022, |P[2]| < 0.34 thus |p23| < 0.35:
+     the rounding (and total) error on p23 is bounded by ulp(0.35) = 2^-54 */
+  ph = __builtin_fma (p45, z2, p23);
+  /* |p45| < 0.22, |z2| < 4.5e-6, |p23| < 0.35 thus |ph| < 0.36:
+     the rounding error on ph is bounded by ulp(0.36) = 2^-54.
+     Adding the error on p45 multiplied by z2, that on z2 multiplied by p45,
+     and that on p23 (ignoring low order errors), we get for the total error
+     on ph the following bound:
+     2^-54 + err(p45)*4.5e-6 + 0.22*err(z2) + err(p23) <
+     2^-54 + 2^-55*4.5e-6 + 0.22*2^-70 + 2^-54 < 2^-52.99 */
+  ph = __builtin_fma (ph, z, P[1]);
+  /* let ph0 be the value at input, and ph1 the value at output:
+     |ph0| < 0.36, |z| < 0.0022, |P[1]| < 0.5 thus |ph1| < 0.501:
+     the rounding error on ph1 is bounded by ulp(0.501) = 2^-53.
+     Adding the error on ph0 multiplied by z, we get for the total error
+     on ph1 the following bound:
+     2^-53 + err(ph0)*0.0022 < 2^-53 + 2^-52.99*0.0022 < 2^-52.99 */
+  ph *= z2;
+  /* let ph2 be the value at output of the above instruction:
+     |ph2| < |z2| * |ph1| < 4.5e-6 * 0.501 < 2.26e-6 thus the
+     rounding error on ph2 is bounded by ulp(2.26e-6) = 2^-71.
+     Adding the error on ph1 multiplied by z2, and the error on z2
+     multiplied by ph1, we get for the total error on ph2 the following bound:
+     2^-71 + err(ph1)*z2 + ph1*err(z2) <
+     2^-71 + 2^-52.99*4.5e-6 + 0.501*2^-70 < 2^-69.32. */
+
+  /* Add e*log(2) to (h,l), where -1074 <= e <= 1023, thus e has at most
+     11 bits. log2_h is an integer multiple of 2^-42, so that e*log2_h
+     is exact. */
+  static const double log2_h = 0x1.62e42fefa38p-1,
+    log2_l = 0x1.ef35793c7673p-45;
+  /* |log(2) - (h+l)| < 2^-102.01 */
+  /* let hh = e * log2_h: hh is an integer multiple of 2^-42,
+     with |hh| <= 1074*log2_h
+     = 3274082061039582*2^-42. l1 is also an integer multiple of 2^-42,
+     with |l1| <= 1524716581803*2^-42. Thus hh+l1 is an integer multiple of
+     2^-42, with 2^42*|hh+l1| <= 3275606777621385 < 2^52, thus hh+l1 is exactly
+     representable. */
+
+  double ee = e;
+  fast_two_sum (h, l, __builtin_fma (ee, log2_h, l1), z);
+  /* here |hh+l1|+|z| <= 3275606777621385*2^-42 + 0.0022 < 745
+     thus |h| < 745, and the additional error from the fast_two_sum() call is
+     bounded by 2^-105*745 < 2^-95.4. */
+  /* add ph + l2 to l */
+  *l = ph + (*l + l2);
+  /* here |ph| < 2.26e-6, |l| < ulp(h) = 2^-43, and |l2| < 2^-43,
+     thus |*l + l2| < 2^-42, and the rounding error on *l + l2 is bounded
+     by ulp(2^-43) = 2^-95 (*l + l2 cannot be >= 2^-42).
+     Now |ph + (*l + l2)| < 2.26e-6 + 2^-42 < 2^-18.7, thus the rounding
+     error on ph + ... is bounded by ulp(2^-18.7) = 2^-71, which yields a
+     cumulated error bound of 2^-71 + 2^-95 < 2^-70.99. */
+
+  *l = __builtin_fma (ee, log2_l, *l);
+  /* let l_in be the input value of *l, and l_out the output value.
+     We have |l_in| < 2^-18.7 (from above)
+     and |e*log2_l| <= 1074*0x1.ef35793c7673p-45
+     thus |l_out| < 2^-18.69 and err(l_out) <= ulp(2^-18.69) = 2^-71 */
+
+  /* The absolute error on h + l is bounded by:
+     2^-70.278 from the error in the Sollya polynomial
+     2^-91.94 for the maximal difference |e*(log(2)-(log2_h + log2_l))|
+              (|e| <= 1074 and |log(2)-(log2_h + log2_l)| < 2^-102.01)
+     2^-97 for the maximal difference |l1 + l2 - (-log(r))|
+     2^-69.32 from the rounding errors in the polynomial evaluation
+     2^-95.4 from the fast_two_sum call
+     2^-70.99 from the *l = ph + (*l + l2) instruction
+     2^-71 from the last __builtin_fma call.
+     This gives an absolute error bounded by < 2^-68.22.
+  */
+
+  /* Absolute error bounded by 2^-68.22 < 0x1.b8p-69.
+     Using the Gappa tool (https://gappa.gitlabpages.inria.fr/) we can
+     improve the bound to 2.89253666698316e-21 < 0x1.b6p-69
+     (see file ../log/gappa.sage).
+
+     What we proved with gappa (see file ../log/log1_template.g):
+     for each interval i, 362 <= i <= 724:
+     if y is a binary64 number in the range i*2^-9 <= y < (i+1)*2^-9,
+     if -1074 <= e <= 1024, assuming the absolute error from the Sollya
+     polynomial is bounded by 2^-70.278, the difference between log(2)
+     and log2_h + log2_l is bounded by 1.95853e-31, and the maximal
+     difference between -log(r) and l1+l2 is bounded by 2^-96, then
+     (a) z is exact
+     (b) we have the following bounds:
+     -2.4696201316824195e-21 <= h + l - log(2^e*y) <= 2.89253666698316e-21
+     with the largest bounds obtained for i=369, RNDD (left bound) and
+     RNDZ (right bound). */
+}
+
+/* The following is a degree-11 polynomial generated by Sollya
+   approximating log(1+x) for |x| < 0.03125,
+   with absolute error < 2^-73.441 and relative error < 2^-67.088
+   (see file Pabs_a.sollya).
+   The polynomial is P[0]*x + P[1]*x^2 + ... + P[10]*x^11.
+   The algorithm assumes that the degree-1 coefficient P[0] is 1
+   and the degree-2 coefficient P[1] is -0.5. */
+static const double __cr_log1p_Pa[11] = {0x1p0,          /* degree 1 */
+                                  -0x1p-1,               /* degree 2 */
+                                  0x1.5555555555555p-2,  /* degree 3 */
+                                  -0x1.ffffffffffe5fp-3, /* degree 4 */
+                                  0x1.999999999aa82p-3,  /* degree 5 */
+                                  -0x1.555555583a8c8p-3, /* degree 6 */
+                                  0x1.2492491c359e6p-3,  /* degree 7 */
+                                  -0x1.ffffc728edeeap-4, /* degree 8 */
+                                  0x1.c71c961f3498p-4,   /* degree 9 */
+                                  -0x1.9a82ac77c05f4p-4, /* degree 10 */
+                                  0x1.74b40dd1707d3p-4,  /* degree 11 */
+};
+
+/* Given |x| < 2^-5, put in h+l a double-double approximation of log(1+x).
+   From analyze_x_plus_p1a(rel=true,Xmax=2^-5.) in the accompanying file
+   ../log1p/log1p.sage, the relative error is bounded by 2^-61.14 with
+   respect to h, and the ratio |l/h| is bounded by 2^-50.96.
+   The caller is responsible for inputs so small that l might underflow. */
+static inline void
+__cr_log1p_fast_small (double *h, double *l, double x)
+{
+  const double *Pa = __cr_log1p_Pa;
+  double z2h, z2l, ph, lo;
+  a_mul (&z2h, &z2l, x, x);
+  double z4h = z2h * z2h;
+  double p910 = __builtin_fma (Pa[10], x, Pa[9]);
+  double p78 = __builtin_fma (Pa[8], x, Pa[7]);
+  double p56 = __builtin_fma (Pa[6], x, Pa[5]);
+  double p34 = __builtin_fma (Pa[4], x, Pa[3]);
+  double p710 = __builtin_fma (p910, z2h, p78);
+  double p36 = __builtin_fma (p56, z2h, p34);
+  ph = __builtin_fma (p710, z4h, p36);
+  ph = __builtin_fma (ph, x, Pa[2]);
+  ph *= z2h;
+  /* now -0.5*z2h + ph*x approximates log(1+x)-x, with absolute error
+     bounded by 2^-67.14 for |x| < 0.03125 (analyze_p1a(-0.03125,0.03125)
+     from ../log1p/log1p.sage) */
+  fast_two_sum (&ph, &lo, -0.5 * z2h, ph * x);
+  lo += -0.5 * z2l;
+  fast_two_sum (h, l, x, ph);
+  *l += lo;
+}
+
+/* Return log(1+x) correctly rounded, for |x| < 0.0625, where a is the
+   result of a fast path (such as that of log1p), which selects the entries
+   of the tables: this is the accurate path of log1p for small x, which
+   unlike __cr_log1p_accurate() stays accurate relative to log(1+x) as x
+   tends to 0. */
+double __cr_log1p_accurate_small (double x, double a) CORE_MATH_HIDDEN;
+
+/* Given x > -1, put in h+l a double-double approximation of log(1+x),
+   with absolute error bounded by 2^-68.02 (details below).
+   We have |h| < 745 and |l| < 2^-18.68. */
+static inline void
+__cr_log1p_fast (double *h, double *l, double x)
+{
+  /* (xh,xl) <- 1+x: for x >= 2^53, 1+x might round to +Inf, and xl/xh
+     below might underflow, thus as in the former log1p fast path, we take
+     xh=x and xl=1, or xl=0 when x >= 2^106, since then the ignored term
+     log(1+1/x) < 2^-106 is negligible */
+  double xh, xl;
+  if (__builtin_expect (x >= 0x1p53, 0))
+  {
+    xh = x;
+    xl = (x < 0x1p106) ? 1.0 : 0.0;
+  }
+  else if (x > 1.0)
+    fast_two_sum (&xh, &xl, x, 1.0);
+  else
+    fast_two_sum (&xh, &xl, 1.0, x);
+
+  d64u64 v = {.f = xh};
+  int e = (v.u >> 52) - 0x3ff;
+  v.u = (0x3ffull << 52) | (v.u & 0xfffffffffffff);
+  __cr_log_fast (h, l, e, v);
+
+  /* log(xh+xl) = log(xh) + log(1+xl/xh) */
+  double c = xl / xh;
+  /* Since |xl| < ulp(xh), we have |xl| < 2^-52 |xh|,
+     thus |c| < 2^-52, and since |log(1+x)-x| < x^2 for |x| < 0.5,
+     we have |log(1+c)-c)| < c^2 < 2^-104 (this also bounds the term
+     log(1+1/x) ignored for x >= 2^106). */
+  *l += c;
+  /* Since |l_in| < 2^-18.69 (from the analysis of __cr_log_fast),
+     and |c| < 2^-52, we have |l| < 2^-18.68, thus the
+     rounding error in *l += c is bounded by ulp(2^-18.68) = 2^-71.
+     The total absolute error is thus bounded by:
+     0x1.b6p-69 + 2^-104 + 2^-71 < 2^-68.02. */
+}
+
+/* Put in r an approximation of log(x), for x > 0 (x may be subnormal),
+   with about 122 bits of accuracy. */
+void __cr_log_accurate (dint64_t *r, double x) CORE_MATH_HIDDEN;
+
+/* Number of inputs processed together by __cr_log_accurate_lanes(). */
+#define CORE_MATH_LOG_LANES 4
+
+/* Put in r[k] the value computed by __cr_log_accurate (r + k, x[k]), for
+   0 <= k < CORE_MATH_LOG_LANES: the operations done for each input are the
+   same, but the multiplications of the different inputs are interleaved,
+   so that they can overlap. */
+void __cr_log_accurate_lanes (dint64_t *r, const double *x) CORE_MATH_HIDDEN;
+
+/* Put in r an approximation of log(1+x), for x > -1, with about 122 bits
+   of accuracy relative to log(1+x) when |x| >= 2^-10. */
+void __cr_log1p_accurate (dint64_t *r, double x) CORE_MATH_HIDDEN;
+
+#endif
@@ -0,0 +1,156 @@
+/* Shared logarithm kernel for the binary64 inverse hyperbolic functions.
+
+Copyright (c) 2023 Alexei Sibidanov.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* References:
+   [1] Tight and rigourous error bounds for basic building blocks of
+       double-word arithmetic, by Mioara Joldeş, Jean-Michel Muller,
+       and Valentina Popescu, ACM Transactions on Mathematical Software,
+       44(2), 2017.
+   [2] Formalization of double-word arithmetic, and comments on ”Tight and
+       rigorous error bounds for basic building blocks of double-word
+       arithmetic”, Jean-Michel Muller, Laurence Rideau,
+       https://hal.science/hal-02972245v2, 2021.
+*/
+
+/*
+  The functions asinh, acosh and atanh are logarithms: asinh(x) =
+  log(|x| + sqrt(x^2+1)), acosh(x) = log(x + sqrt(x^2-1)) and atanh(x) =
+  log((1+x)/(1-x))/2. Once each of them has computed the argument z of the
+  logarithm as a double-double, they share:
+  - the first argument reduction __cr_logh_reduce(), which writes
+    z = 2^e*m and approximates 1/m by r1*r2, where the tables __cr_logh_t1
+    and __cr_logh_t2 hold r1 and r2 together with -log(r1) and -log(r2)
+    as double-doubles (low part first), and the polynomial __cr_logh_c
+    approximating log(1+dx) - dx;
+  - the accurate path __cr_logh_accurate() in logh_core.c.
+  Each function keeps its own evaluation of z, its paths near 0 (or near 1
+  for acosh), the error bounds of its fast path, its rounding test and its
+  database of exceptions. Functions using this kernel need to be linked
+  with logh_core.o.
+*/
+
+#ifndef CORE_MATH_LOGH_CORE_H
+#define CORE_MATH_LOGH_CORE_H
+
+#include <stdint.h>
+
+typedef uint64_t u64;
+typedef union {double f; u64 u;} b64u64_u;
+
+/* the kernel symbols are internal to the library */
+#if defined(__GNUC__) && defined(__ELF__)
+#define CORE_MATH_HIDDEN __attribute__((visibility("hidden")))
+#else
+#define CORE_MATH_HIDDEN
+#endif
+
+static inline double fasttwosum(double x, double y, double *e){
+  double s = x + y, z = s - x;
+  *e = y - z;
+  return s;
+}
+
+static inline double adddd(double xh, double xl, double ch, double cl, double *l) {
+  double s = xh + ch, d = s - xh;
+  *l = ((ch - d) + (xh + (d - s))) + (xl + cl);
+  return s;
+}
+
+/* This function implements Algorithm 10 (DWTimesDW1) from [1]
+   Its relative error (for round-to-nearest ties-to-even) is bounded by 5u^2
+   (Theorem 2.6 of [2]), where u = 2^-53 for double precision,
+   assuming xh = RN(xh + xl), which implies |xl| <= 1/2 ulp(xh),
+   and similarly for ch, cl. */
+static inline double muldd(double xh, double xl, double ch, double cl, double *l){
+  double ahlh = ch*xl, alhh = cl*xh, ahhh = ch*xh, ahhl = __builtin_fma(ch, xh, -ahhh);
+  ahhl += alhh + ahlh;
+  ch = ahhh + ahhl;
+  *l = (ahhh - ch) + ahhl;
+  return ch;
+}
+
+static inline double mulddd(double xh, double xl, double ch, double *l){
+  double ahlh = ch*xl, ahhh = ch*xh, ahhl = __builtin_fma(ch, xh, -ahhh);
+  ahhl += ahlh;
+  ch = ahhh + ahhl;
+  *l = (ahhh - ch) + ahhl;
+  return ch;
+}
+
+static inline double polydd(double xh, double xl, int n, const double c[][2], double *l){
+  int i = n-1;
+  double ch = c[i][0] + *l, cl = ((c[i][0] - ch) + *l) + c[i][1];
+  while(--i>=0){
+    ch = muldd(xh, xl, ch, cl, &cl);
+    double th = ch + c[i][0], tl = (c[i][0] - th) + ch;
+    ch = th;
+    cl += tl + c[i][1];
+  }
+  *l = cl;
+  return ch;
+}
+
+typedef struct {uint16_t c0; int16_t c1;} __cr_logh_b_t;
+
+/* __cr_logh_B[i] gives the correction to the top bits of the mantissa m
+   from which the indices i1, i2 below are computed */
+extern const __cr_logh_b_t __cr_logh_B[32] CORE_MATH_HIDDEN;
+/* __cr_logh_t1[i1] = {r1, l1l, l1h, 0} and __cr_logh_t2[i2] = {r2, l2l, l2h, 0}
+   where r1*r2 approximates 1/m, and l1h + l1l and l2h + l2l approximate
+   -log(r1) and -log(r2) as double-doubles. The entries used together are
+   stored in one row, padded to 32 bytes so that it lies in one cache line. */
+extern const double __cr_logh_t1[33][4] CORE_MATH_HIDDEN;
+extern const double __cr_logh_t2[33][4] CORE_MATH_HIDDEN;
+
+/* log(1+dx) - dx ~ dx^2*(c[0] + dx*c[1] + dx^2*c[2] + dx^3*c[3] + dx^4*c[4]) */
+static const double __cr_logh_c[] = {-0x1p-1, 0x1.555555555553p-2, -0x1.fffffffffffap-3, 0x1.99999e33a6366p-3, -0x1.555559ef9525fp-3};
+
+/* Write 2^(0x3ff-off)*z = 2^e*m with 1 <= m < 2 (off is 0x3ff, or 0x3fe
+   to compute log(2z)), set *i1 and *i2 such that
+   __cr_logh_t1[*i1][0]*__cr_logh_t2[*i2][0] approximates 1/m, and return m. */
+static inline double __cr_logh_reduce(double z, int off, int *e, int *i1, int *i2){
+  b64u64_u t = {.f = z};
+  int ex = t.u>>52;
+  *e = ex - off;
+  t.u &= ~(u64)0>>12;
+  u64 i = t.u>>(52-5);
+  int64_t d = t.u & (~(u64)0>>17);
+  u64 j = (t.u + ((u64)__cr_logh_B[i].c0<<33) + ((int64_t)__cr_logh_B[i].c1*(d>>16)))>>(52-10);
+  t.u |= (u64)0x3ff<<52;
+  *i1 = j>>5;
+  *i2 = j&0x1f;
+  return t.f;
+}
+
+/* Accurate path: given z = zh + zl > 0, k = 0 or 1, and a ~ log2(2^k*z),
+   return v0 and set *l to v1 such that v0 + v1 approximates log(2^k*z)/2.
+   The last bit of v1 is adjusted with the next term, so that v0 + v1 rounds
+   correctly unless the result is very close to a rounding boundary, which
+   the caller checks with its own (scaled) threshold. */
+double __cr_logh_accurate(double zh, double zl, double a, int k, double *l)
+  CORE_MATH_HIDDEN;
+
+#endif /* CORE_MATH_LOGH_CORE_H */
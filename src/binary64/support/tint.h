@@ -24,6 +24,10 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+#ifndef CORE_MATH_TINT_H
+#define CORE_MATH_TINT_H
+
+#include <stdio.h>
 #include <stdlib.h>
 #include <inttypes.h>
 #if defined(__x86_64__)
@@ -90,6 +94,15 @@ static const tint_t PI2 = {
   .h = 0xc90fdaa22168c234, .m = 0xc4c6628b80dc1cd1, .l = 0x29024e088a67cc74,
   .ex = 1, .sgn = 0};
 
+// ONE_HALF is a tint_t representation of 1/2
+static const tint_t ONE_HALF = {
+  .h = 0x8000000000000000, .m = 0, .l = 0, .ex = 0, .sgn = 0};
+
+// ONE_OVER_PI is a tint_t representation of 1/pi, with rel. error < 2^-198.59
+static const tint_t ONE_OVER_PI = {
+  .h = 0xa2f9836e4e441529, .m = 0xfc2757d1f534ddc0, .l = 0xdb6295993c439042,
+  .ex = -1, .sgn = 0};
+
 // Print a tint_t value for debugging purposes
 static inline void print_tint (const tint_t *a) {
   printf("{.h=0x%"PRIx64", .m=0x%"PRIx64", .l=0x%"PRIx64", .ex=%"PRId64", .sgn=0x%"PRIx64"}\n",
@@ -398,7 +411,7 @@ static inline double as_ldexp(double x, int64_t i){
 // convert a to a double with correct rouding
 // If err=0, we are converting a double value.
 // Otherwise, err is a bound in ulps on the maximal error on a->l
-// y,x are the inputs of atan2 (in case we can't round correctly)
+// y,x are the inputs of atan2 or atan2pi (in case we can't round correctly)
 static inline double
 tint_tod (const tint_t *a, uint64_t err, double y, double x)
 {
@@ -426,7 +439,7 @@ tint_tod (const tint_t *a, uint64_t err, double y, double x)
         (~mm == 0 && (low == 0x3ff || low == 0x7ff) && ~ll < err))
     {
       printf ("Unexpected worst-case found, please report to core-math@inria.fr:\n");
-      printf ("Worst-case of atan2 found: y,x=%la,%la\n", y, x);
+      printf ("Worst-case of atan2 or atan2pi found: y,x=%la,%la\n", y, x);
       exit (1);
     }
   if (ex <= -1022) // subnormal case
@@ -556,3 +569,5 @@ static inline void div_tint_d (tint_t *r, double b, double a)
   tint_fromd (B, b);
   div_tint (r, B, A);
 }
+
+#endif
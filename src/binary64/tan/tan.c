@@ -33,6 +33,16 @@ SOFTWARE.
 #include <fenv.h>
 #include <errno.h>
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -2084,6 +2094,7 @@ tan_fast (double *h, double *l, double x)
 static double
 tan_accurate (double x)
 {
+  CORE_MATH_STAT ("tan_accurate");
   double absx = (x > 0) ? x : -x;
 
   dint64_t X[1];
@@ -2247,6 +2258,8 @@ tan_accurate (double x)
 double
 cr_tan (double x)
 {
+  CORE_MATH_STAT ("calls");
+  CORE_MATH_ARGS (x);
   b64u64_u t = {.f = x};
   int e = (t.u >> 52) & 0x7ff;
 
@@ -30,6 +30,16 @@ SOFTWARE.
 #include <fenv.h>
 #include <math.h> // needed to provide tanpi() since glibc does not have it
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -87,6 +97,7 @@ static inline double polydd(double xh, double xl, int n, const double c[][2], do
 }
 
 static __attribute__((noinline)) double as_tanpi_database(double x, double f){
+  CORE_MATH_STAT("as_tanpi_database");
   static const double db[][3] = {
     {0x1.b44453e2404e7p-55, 0x1.56a4aa740a5a7p-53, 0x1p-107},
     {0x1.45435c15060dcp-54, 0x1.feec101084f24p-53,-0x1p-107},
@@ -172,6 +183,8 @@ static __attribute__((noinline)) double as_tanpi_database(double x, double f){
 }
 
 double cr_tanpi(double x){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x);
   static const double T[][2] =
     {{0x0p+0, 0x0p+0},{0x1.ada13ceebab9dp-64, 0x1.927278a3b1162p-5},
      {0x1.87d054f689d7ap-58, 0x1.936bb8c5b2da2p-4},{0x1.2cfb5a746f62cp-58, 0x1.2fcac73a6064p-3},
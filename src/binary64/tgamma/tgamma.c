@@ -32,6 +32,16 @@ SOFTWARE.
 #include <fenv.h>
 #endif
 
+/* counters of the CORE_MATH_STATS builds, see generic/support/stats.h */
+#ifndef CORE_MATH_STAT
+#define CORE_MATH_STAT(path)
+#endif
+
+/* inputs of the USDT probes of the CORE_MATH_USDT builds, see generic/support/usdt.h */
+#ifndef CORE_MATH_ARGS
+#define CORE_MATH_ARGS(...)
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -202,6 +212,7 @@ static double poly3(double d, unsigned imax, const double ch[], unsigned jmax, c
 }
 
 static __attribute__((noinline)) double as_tgamma_database(double x, double f){
+  CORE_MATH_STAT("as_tgamma_database");
   static const double db[][3] = {
     {-0x1.48ba8e27d09adp+7, -0x1.0b34f909c5c92p-976, 0x0.01p-1022},
     {-0x1.1fe464bbe8b7ap+7, 0x1.f6e94380a86bfp-826, 0x1p-880},
@@ -292,6 +303,7 @@ raise_underflow (void)
 }
 
 static __attribute__((noinline)) double as_tgamma_accurate(double x){
+  CORE_MATH_STAT("as_tgamma_accurate");
   if(__builtin_fabs(x)<0.25){
     static const double cc[][2] = {
       {-0x1.2788cfc6fb619p-1, 0x1.6cb90701fbfbap-58}, {0x1.fa658c23b1578p-1, 0x1.dd92b465a81ddp-55},
@@ -618,6 +630,8 @@ static __attribute__((noinline)) double as_tgamma_accurate(double x){
 }
 
 double cr_tgamma(double x){
+  CORE_MATH_STAT("calls");
+  CORE_MATH_ARGS(x);
   b64u64_u t = {.f = x};
   uint64_t ax = t.u<<1;
   if(__builtin_expect(ax>=(0x7fful<<53), 0)){ /* x=NaN or +/-Inf */
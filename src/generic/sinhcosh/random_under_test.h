@@ -0,0 +1,16 @@
+#include <math.h>
+
+static inline TYPE_UNDER_TEST random_under_test (void)
+{
+  /* sample in [-10,10] */
+  return 20 * ((TYPE_UNDER_TEST) rand() / (TYPE_UNDER_TEST) RAND_MAX) - 10;
+}
+
+/* The libc has no sinhcosh: the reference is the pair of calls that
+   cr_sinhcosh replaces. */
+void
+sinhcosh (TYPE_UNDER_TEST x, TYPE_UNDER_TEST *s, TYPE_UNDER_TEST *c)
+{
+  *s = sinh (x);
+  *c = cosh (x);
+}
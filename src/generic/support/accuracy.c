@@ -0,0 +1,391 @@
+/* Accuracy and speed of core-math and other libms (Pareto table).
+
+Copyright (c) 2025 The CORE-MATH Authors.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* Usage (built by make accuracy in the directory of a function, see
+   pareto.sh):
+     ./accuracy [--count N] [--repeat M] [--dist SPEC] [--csv]
+                [--rndn|--rndz|--rndu|--rndd] [--lib path.so ...]
+
+   The program samples --count inputs (1000000 by default) with
+   random_under_test(), or from --dist (see perf_dist.h), and evaluates on
+   them core-math, the libm it is linked with ($LIBM, or the libc), and
+   each library given with --lib (loaded with dlopen, where the function
+   is looked up under its name, then with the cr_ prefix). For each
+   implementation, it prints:
+   - the cycles/call in throughput (minimum over --repeat passes, 10 by
+     default, with rdtsc);
+   - the maximal and mean error in ulps, with respect to the exact value
+     computed by MPFR with ACC_PREC more bits (mpfr_function_under_test,
+     see function_under_test.h), the ulp being the one of the format at
+     the exact value;
+   - the fraction of the results which differ from the correctly rounded
+     ones (ref_function_under_test, see $NAME_mpfr.c), NaN being equal to
+     any NaN.
+   An implementation is on the Pareto frontier (marked with *) when no
+   other one is at least as fast and at least as accurate (maximal error),
+   and better in one of them. With --csv, the table is printed as CSV
+   lines function,impl,cycles,max_ulps,mean_ulps,incorrect,pareto. */
+
+#define _GNU_SOURCE /* for RTLD_DEFAULT */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <fenv.h>
+#include <dlfcn.h>
+#include <mpfr.h>
+#ifdef __x86_64__
+#include <x86intrin.h>
+#else
+#include <time.h>
+/* elsewhere, the "cycles" are nanoseconds */
+static inline uint64_t
+__rdtsc (void)
+{
+  struct timespec t;
+  clock_gettime (CLOCK_MONOTONIC, &t);
+  return (uint64_t) t.tv_sec * 1000000000 + t.tv_nsec;
+}
+#endif
+
+#include "random_under_test.h"
+#include "function_under_test.h"
+
+#ifndef ACCURACY_ARITY
+#define ACCURACY_ARITY 1
+#endif
+
+#if ACCURACY_ARITY == 1
+typedef TYPE_UNDER_TEST function_type_under_test (TYPE_UNDER_TEST);
+#define CALL(f,r,i) (f (r[i]))
+#else
+typedef TYPE_UNDER_TEST function_type_under_test (TYPE_UNDER_TEST, TYPE_UNDER_TEST);
+#define CALL(f,r,i) (f (r[2 * (i)], r[2 * (i) + 1]))
+#endif
+
+function_type_under_test cr_function_under_test;
+function_type_under_test function_under_test;
+function_type_under_test ref_function_under_test;
+int ref_fesetround (int);
+void ref_init (void);
+
+#define SAMPLE_SIZE (ACCURACY_ARITY * sizeof(TYPE_UNDER_TEST))
+#include "perf_dist.h"
+
+#define ACC_MAX_IMPLS 18 /* core-math, the libm, and 16 --lib */
+#define ACC_PREC 64      /* extra bits of the exact values */
+
+/* precision and exponent (MPFR convention) of the smallest normal number
+   of TYPE_UNDER_TEST */
+#define ACC_MANT_DIG                                                    \
+  ((sizeof (TYPE_UNDER_TEST) == sizeof (float)) ? FLT_MANT_DIG          \
+   : (sizeof (TYPE_UNDER_TEST) == sizeof (double)) ? DBL_MANT_DIG       \
+   : LDBL_MANT_DIG)
+#define ACC_MIN_EXP                                                     \
+  ((sizeof (TYPE_UNDER_TEST) == sizeof (float)) ? FLT_MIN_EXP           \
+   : (sizeof (TYPE_UNDER_TEST) == sizeof (double)) ? DBL_MIN_EXP        \
+   : LDBL_MIN_EXP)
+
+static int rnd1[] = { FE_TONEAREST, FE_TOWARDZERO, FE_UPWARD, FE_DOWNWARD };
+
+static int rnd = 0;
+
+typedef struct {
+  const char *name;
+  function_type_under_test *f;
+  double cycles, max_ulps, sum_ulps;
+  long incorrect;
+  int pareto;
+} impl_t;
+
+/* The error in ulps of y with respect to the exact value e, or
+   DBL_MAX if y is not finite but e is, or the converse. */
+static double
+ulps (TYPE_UNDER_TEST y, mpfr_srcptr e, mpfr_ptr t)
+{
+  int fy = y == y && y - y == 0; /* finite, without isfinite() in case of
+                                    -ffinite-math-only */
+  if (!fy || !mpfr_number_p (e))
+    return (!fy && !mpfr_number_p (e)) ? 0 : DBL_MAX;
+  mpfr_set_ld (t, y, MPFR_RNDN); /* exact */
+  mpfr_sub (t, t, e, MPFR_RNDN);
+  long ex = mpfr_zero_p (e) ? ACC_MIN_EXP : mpfr_get_exp (e);
+  if (ex < ACC_MIN_EXP)
+    ex = ACC_MIN_EXP;
+  mpfr_mul_2si (t, t, ACC_MANT_DIG - ex, MPFR_RNDN);
+  return fabs (mpfr_get_d (t, MPFR_RNDN));
+}
+
+/* the exact value of the function on input i, with ACC_PREC more bits */
+static void
+exact (mpfr_ptr e, const TYPE_UNDER_TEST *randoms, long i, mpfr_ptr x,
+       mpfr_ptr y)
+{
+#if ACCURACY_ARITY == 1
+  mpfr_set_ld (x, randoms[i], MPFR_RNDN);
+  mpfr_function_under_test (e, x, MPFR_RNDN);
+  (void) y;
+#else
+  mpfr_set_ld (x, randoms[2 * i], MPFR_RNDN);
+  mpfr_set_ld (y, randoms[2 * i + 1], MPFR_RNDN);
+  mpfr_function_under_test (e, x, y, MPFR_RNDN);
+#endif
+}
+
+static void
+measure (impl_t *m, const TYPE_UNDER_TEST *randoms, const TYPE_UNDER_TEST *cr,
+         mpfr_t *e, long count, int repeat)
+{
+  function_type_under_test *f = m->f;
+  volatile TYPE_UNDER_TEST sink;
+  m->cycles = DBL_MAX;
+  for (int r = 0; r < repeat; r++)
+    {
+      uint64_t start = __rdtsc ();
+      for (long i = 0; i < count; i++)
+        sink = CALL (f, randoms, i);
+      double c = (double) (__rdtsc () - start) / count;
+      if (c < m->cycles)
+        m->cycles = c;
+    }
+  (void) sink;
+
+  mpfr_t t;
+  mpfr_init2 (t, ACC_MANT_DIG + ACC_PREC);
+  m->max_ulps = m->sum_ulps = 0;
+  m->incorrect = 0;
+  for (long i = 0; i < count; i++)
+    {
+      TYPE_UNDER_TEST y = CALL (f, randoms, i);
+      if (memcmp (&y, &cr[i], sizeof (y)) != 0 && (y == y || cr[i] == cr[i]))
+        m->incorrect++;
+      double u = ulps (y, e[i], t);
+      if (u > m->max_ulps)
+        m->max_ulps = u;
+      m->sum_ulps += u;
+    }
+  mpfr_clear (t);
+}
+
+static void
+print_ulps (double u)
+{
+  if (u == DBL_MAX)
+    printf (" %10s", "inf");
+  else
+    printf (" %10.3f", u);
+}
+
+int
+main (int argc, char *argv[])
+{
+  long count = 1000000;
+  int repeat = 10, csv = 0, nimpls = 0;
+  dist_t dist = { .kind = DIST_DEFAULT };
+  impl_t impls[ACC_MAX_IMPLS];
+
+  impls[nimpls++] = (impl_t) { .name = "core-math",
+                               .f = cr_function_under_test };
+  impls[nimpls++] = (impl_t) { .name = "libm", .f = function_under_test };
+
+  while (argc >= 2)
+    {
+      if (strcmp (argv[1], "--rndn") == 0)
+        rnd = 0;
+      else if (strcmp (argv[1], "--rndz") == 0)
+        rnd = 1;
+      else if (strcmp (argv[1], "--rndu") == 0)
+        rnd = 2;
+      else if (strcmp (argv[1], "--rndd") == 0)
+        rnd = 3;
+      else if (strcmp (argv[1], "--csv") == 0)
+        csv = 1;
+      else if (strcmp (argv[1], "--count") == 0 && argc >= 3)
+        {
+          count = atol (argv[2]);
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--repeat") == 0 && argc >= 3)
+        {
+          repeat = atoi (argv[2]);
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--dist") == 0 && argc >= 3)
+        {
+          dist_parse (&dist, argv[2]);
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--lib") == 0 && argc >= 3)
+        {
+          if (nimpls == ACC_MAX_IMPLS)
+            {
+              fprintf (stderr, "Error, too many --lib\n");
+              exit (1);
+            }
+          void *h = dlopen (argv[2], RTLD_NOW | RTLD_LOCAL);
+          if (h == NULL)
+            {
+              fprintf (stderr, "Error, %s\n", dlerror ());
+              exit (1);
+            }
+          const char *name = DIST_STR (function_under_test);
+          void *f = dlsym (h, name);
+          if (f == NULL)
+            {
+              char cr[64];
+              snprintf (cr, sizeof (cr), "cr_%s", name);
+              f = dlsym (h, cr);
+            }
+          if (f == NULL)
+            {
+              fprintf (stderr, "Error, no %s in %s\n", name, argv[2]);
+              exit (1);
+            }
+          const char *base = strrchr (argv[2], '/');
+          impls[nimpls++] = (impl_t) { .name = base ? base + 1 : argv[2],
+                                       .f = (function_type_under_test *) f };
+          argc --;
+          argv ++;
+        }
+      else
+        {
+          fprintf (stderr, "Error, unknown option %s\n", argv[1]);
+          exit (1);
+        }
+      argc --;
+      argv ++;
+    }
+  if (count <= 0 || repeat <= 0)
+    {
+      fprintf (stderr, "Error, invalid --count or --repeat\n");
+      exit (1);
+    }
+
+  TYPE_UNDER_TEST *randoms = malloc (count * SAMPLE_SIZE);
+  TYPE_UNDER_TEST *cr = malloc (count * sizeof (TYPE_UNDER_TEST));
+  mpfr_t *e = malloc (count * sizeof (mpfr_t));
+  if (randoms == NULL || cr == NULL || e == NULL)
+    {
+      perror ("malloc");
+      exit (3);
+    }
+  dist_fill (randoms, count, &dist);
+
+  /* the correctly rounded results, then the exact values, with the
+     largest exponent range */
+  ref_init ();
+  ref_fesetround (rnd);
+  for (long i = 0; i < count; i++)
+    {
+#if ACCURACY_ARITY == 1
+      cr[i] = ref_function_under_test (randoms[i]);
+#else
+      cr[i] = ref_function_under_test (randoms[2 * i], randoms[2 * i + 1]);
+#endif
+    }
+  mpfr_set_emin (mpfr_get_emin_min ());
+  mpfr_set_emax (mpfr_get_emax_max ());
+  mpfr_t x, y;
+  mpfr_init2 (x, ACC_MANT_DIG);
+  mpfr_init2 (y, ACC_MANT_DIG);
+  for (long i = 0; i < count; i++)
+    {
+      mpfr_init2 (e[i], ACC_MANT_DIG + ACC_PREC);
+      exact (e[i], randoms, i, x, y);
+    }
+  mpfr_clear (x);
+  mpfr_clear (y);
+
+  fesetround (rnd1[rnd]);
+  for (int k = 0; k < nimpls; k++)
+    measure (&impls[k], randoms, cr, e, count, repeat);
+  fesetround (FE_TONEAREST);
+
+  for (int k = 0; k < nimpls; k++)
+    {
+      impls[k].pareto = 1;
+      for (int j = 0; j < nimpls; j++)
+        if (impls[j].cycles <= impls[k].cycles
+            && impls[j].max_ulps <= impls[k].max_ulps
+            && (impls[j].cycles < impls[k].cycles
+                || impls[j].max_ulps < impls[k].max_ulps))
+          impls[k].pareto = 0;
+    }
+
+  /* by increasing cycles/call */
+  int order[ACC_MAX_IMPLS];
+  for (int k = 0; k < nimpls; k++)
+    {
+      int j = k;
+      for (; j > 0 && impls[order[j - 1]].cycles > impls[k].cycles; j--)
+        order[j] = order[j - 1];
+      order[j] = k;
+    }
+
+  const char *mode[] = { "to nearest", "toward zero", "upward",
+                         "downward" };
+  if (!csv)
+    {
+      printf ("%s: %ld inputs (%s), rounding %s\n",
+              DIST_STR (function_under_test), count,
+              dist.kind == DIST_DEFAULT ? "random_under_test" : dist.spec,
+              mode[rnd]);
+      printf ("  %-20s %11s %10s %10s %10s %s\n", "impl", "cycles/call",
+              "max ulps", "mean ulps", "incorrect", "pareto");
+    }
+  for (int j = 0; j < nimpls; j++)
+    {
+      impl_t *m = &impls[order[j]];
+      double mean = m->sum_ulps / count;
+      if (csv)
+        {
+          printf ("%s,%s,%.3f,", DIST_STR (function_under_test), m->name,
+                  m->cycles);
+          if (m->max_ulps == DBL_MAX)
+            printf ("inf,inf,");
+          else
+            printf ("%.3f,%.3f,", m->max_ulps, mean);
+          printf ("%.6f,%d\n", (double) m->incorrect / count, m->pareto);
+          continue;
+        }
+      printf ("  %-20s %11.3f", m->name, m->cycles);
+      print_ulps (m->max_ulps);
+      print_ulps (m->max_ulps == DBL_MAX ? DBL_MAX : mean);
+      printf (" %9.4f%% %s\n", 100.0 * m->incorrect / count,
+              m->pareto ? "*" : "");
+    }
+
+  for (long i = 0; i < count; i++)
+    mpfr_clear (e[i]);
+  free (e);
+  free (cr);
+  free (randoms);
+  return 0;
+}
@@ -0,0 +1,299 @@
+/* Count the cache lines of tables touched by a function.
+
+Copyright (c) 2025 The CORE-MATH Authors.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* The function under test (and its shared kernels) is compiled with
+   -fsanitize=kernel-address and outline instrumentation (see the cachelines
+   target in Makefile.univariate), so that the compiler inserts a call to
+   __asan_loadN_noabort(addr) before each load. Instead of the sanitizer
+   runtime, this file defines these functions: they record the 64-byte
+   lines of the loads that hit the image of the program (the tables in
+   .rodata and .data), and ignore the stack and the heap. For each call of
+   the function, the number of distinct lines is counted.
+
+   The output gives the distribution of the number of lines per call, which
+   for most inputs is the number of lines touched by the fast path, and the
+   footprint, i.e., the number of distinct lines touched by all calls. With
+   --lines, the lines are also listed with their number of hits, as offsets
+   from the start of the image (see cachelines.sh, which maps them to
+   symbols). */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <fenv.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "random_under_test.h"
+
+#ifndef CACHELINES_ARITY
+#define CACHELINES_ARITY 1
+#endif
+
+#if CACHELINES_ARITY == 1
+typedef TYPE_UNDER_TEST function_type_under_test (TYPE_UNDER_TEST);
+#define CALL(r,i) (r[i])
+#else
+typedef TYPE_UNDER_TEST function_type_under_test (TYPE_UNDER_TEST, TYPE_UNDER_TEST);
+#define CALL(r,i) (r[2 * (i)], r[2 * (i) + 1])
+#endif
+
+function_type_under_test cr_function_under_test;
+
+#define SAMPLE_SIZE (CACHELINES_ARITY * sizeof(TYPE_UNDER_TEST))
+
+#define LINE_SIZE 64
+#define MAX_CALL_LINES 256     /* distinct lines recorded for one call */
+#define MAX_LINES 65536        /* distinct lines recorded for all calls */
+
+/* provided by the GNU linker */
+extern const char __executable_start[], end[];
+
+int rnd1[] = { FE_TONEAREST, FE_TOWARDZERO, FE_UPWARD, FE_DOWNWARD };
+
+int rnd = 0;
+
+static int recording = 0;
+
+/* lines touched by the current call */
+static uintptr_t call_lines[MAX_CALL_LINES];
+static int n_call_lines = 0, call_overflow = 0;
+
+/* open-addressing hash table of all the lines touched, with hit counts */
+static uintptr_t all_lines[MAX_LINES];
+static uint64_t all_hits[MAX_LINES];
+static int n_all_lines = 0;
+
+static void
+record_line (uintptr_t line)
+{
+  for (int i = 0; i < n_call_lines; i++)
+    if (call_lines[i] == line)
+      return;
+  if (n_call_lines == MAX_CALL_LINES)
+    {
+      call_overflow = 1;
+      return;
+    }
+  call_lines[n_call_lines++] = line;
+}
+
+static void
+record (uintptr_t addr, size_t size)
+{
+  if (!recording || size == 0)
+    return;
+  if (addr < (uintptr_t) __executable_start || addr >= (uintptr_t) end)
+    return; /* stack, heap or shared libraries */
+  for (uintptr_t line = addr / LINE_SIZE; line <= (addr + size - 1) / LINE_SIZE;
+       line++)
+    record_line (line);
+}
+
+/* end of a call: merge the lines of the call into all_lines */
+static int
+flush_call (void)
+{
+  int n = n_call_lines;
+  for (int i = 0; i < n_call_lines; i++)
+    {
+      uintptr_t line = call_lines[i];
+      unsigned h = (unsigned) ((line * 0x9e3779b97f4a7c15ull) >> 48) % MAX_LINES;
+      while (all_hits[h] != 0 && all_lines[h] != line)
+        h = (h + 1) % MAX_LINES;
+      if (all_hits[h] == 0)
+        {
+          if (n_all_lines == MAX_LINES - 1)
+            {
+              fprintf (stderr, "Error, too many distinct lines\n");
+              exit (1);
+            }
+          all_lines[h] = line;
+          n_all_lines++;
+        }
+      all_hits[h]++;
+    }
+  n_call_lines = 0;
+  return n;
+}
+
+#define ASAN_LOAD_STORE(size)                                           \
+  void __asan_load##size##_noabort (uintptr_t addr) { record (addr, size); } \
+  void __asan_store##size##_noabort (uintptr_t addr) { (void) addr; }
+
+ASAN_LOAD_STORE(1)
+ASAN_LOAD_STORE(2)
+ASAN_LOAD_STORE(4)
+ASAN_LOAD_STORE(8)
+ASAN_LOAD_STORE(16)
+
+void __asan_loadN_noabort (uintptr_t addr, size_t size) { record (addr, size); }
+void __asan_storeN_noabort (uintptr_t addr, size_t size) { (void) addr; (void) size; }
+void __asan_handle_no_return (void) { }
+
+static int
+cmp_line (const void *a, const void *b)
+{
+  uintptr_t u = all_lines[*(const int *) a], v = all_lines[*(const int *) b];
+  return (u > v) - (u < v);
+}
+
+int
+main (int argc, char *argv[])
+{
+  int count = 100000, show_lines = 0;
+  char *file = NULL;
+
+  while (argc >= 2)
+    {
+      if (strcmp (argv[1], "--rndn") == 0)
+        {
+          rnd = 0;
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--rndz") == 0)
+        {
+          rnd = 1;
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--rndu") == 0)
+        {
+          rnd = 2;
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--rndd") == 0)
+        {
+          rnd = 3;
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--lines") == 0)
+        {
+          show_lines = 1;
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--file") == 0)
+        {
+          argc --;
+          argv ++;
+          file = argv[1];
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--count") == 0)
+        {
+          argc --;
+          argv ++;
+          count = atoi(argv[1]);
+          argc --;
+          argv ++;
+        }
+      else
+        {
+          fprintf (stderr, "Error, unknown option %s\n", argv[1]);
+          exit (1);
+        }
+    }
+
+  /* the inputs are read from a file written by perf --reference if given,
+     otherwise sampled with random_under_test() */
+  TYPE_UNDER_TEST *randoms = malloc (count * SAMPLE_SIZE);
+  if (randoms == NULL) {
+    perror("malloc");
+    exit(3);
+  }
+  if (file != NULL) {
+    int fd = open(file, O_RDONLY);
+    if (fd < 0) {
+      perror("open");
+      exit(3);
+    }
+    TYPE_UNDER_TEST *mmaped_randoms = mmap(NULL, count * SAMPLE_SIZE, PROT_READ, MAP_SHARED, fd, 0);
+    if (mmaped_randoms == MAP_FAILED) {
+      perror("mmap");
+      exit(3);
+    }
+    memcpy(randoms, mmaped_randoms, count * SAMPLE_SIZE);
+    munmap(mmaped_randoms, count * SAMPLE_SIZE);
+    close(fd);
+  } else {
+    for (unsigned int i = 0; i < count * SAMPLE_SIZE / sizeof(TYPE_UNDER_TEST); i++)
+      randoms[i] = random_under_test();
+  }
+
+  /* histogram of the number of lines per call */
+  uint64_t hist[MAX_CALL_LINES + 1] = {0};
+  uint64_t total = 0;
+  int max = 0;
+  fesetround(rnd1[rnd]);
+  for (int i = 0; i < count; i++)
+    {
+      recording = 1;
+      volatile TYPE_UNDER_TEST y = cr_function_under_test CALL(randoms, i);
+      (void) y;
+      recording = 0;
+      int n = flush_call ();
+      hist[n]++;
+      total += n;
+      if (n > max)
+        max = n;
+    }
+  fesetround(FE_TONEAREST);
+
+  printf ("lines per call: mean %.2f, max %d%s\n", (double) total / count,
+          max, call_overflow ? " (truncated)" : "");
+  for (int n = 0; n <= max; n++)
+    if (hist[n] != 0)
+      printf ("  %3d lines: %6.2f%%\n", n, 100.0 * (double) hist[n] / count);
+  printf ("footprint: %d lines (%d bytes)\n", n_all_lines,
+          n_all_lines * LINE_SIZE);
+
+  if (show_lines)
+    {
+      int *idx = malloc (n_all_lines * sizeof (int)), k = 0;
+      for (int h = 0; h < MAX_LINES; h++)
+        if (all_hits[h] != 0)
+          idx[k++] = h;
+      qsort (idx, n_all_lines, sizeof (int), cmp_line);
+      for (int i = 0; i < n_all_lines; i++)
+        printf ("line 0x%lx %6.2f%%\n",
+                (unsigned long) (all_lines[idx[i]] * LINE_SIZE
+                                 - (uintptr_t) __executable_start),
+                100.0 * (double) all_hits[idx[i]] / count);
+      free (idx);
+    }
+
+  free (randoms);
+  return 0;
+}
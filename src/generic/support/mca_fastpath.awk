@@ -0,0 +1,64 @@
+# Extract the fast path of function fn from the assembly output of gcc -S
+# (AT&T syntax), for llvm-mca. Usage: awk -v fn=cr_exp -f mca_fastpath.awk
+#
+# The fast path is the code executed when each conditional branch falls
+# through, which is how gcc lays out the likely side of __builtin_expect:
+# starting at the entry of fn, the instructions are copied in order, the
+# conditional branches being kept (as not taken), and the unconditional
+# jumps to local labels being followed. It ends at the first return, call
+# (into an accurate, database or special helper, or a shared kernel),
+# tail call, or jump to code already copied. The result is enclosed in
+# LLVM-MCA-BEGIN/END markers, with the reason of the end as a comment.
+
+{ line[NR] = $0 }
+$0 ~ /^[^ \t#][^ \t]*:/ {
+  l = $0
+  sub(/:.*/, "", l)
+  label[l] = NR
+}
+
+function emit_end(why) {
+  print "# LLVM-MCA-END"
+  print "# end: " why
+  exit
+}
+
+END {
+  if (!(fn in label)) {
+    print "mca_fastpath.awk: no function " fn > "/dev/stderr"
+    exit 1
+  }
+  print "# LLVM-MCA-BEGIN " fn
+  for (i = label[fn] + 1; i <= NR; i++) {
+    if (i in copied)
+      emit_end("loop")
+    copied[i] = 1
+    s = line[i]
+    sub(/#.*/, "", s)
+    if (s ~ /^[^ \t]/)          # label
+      continue
+    n = split(s, w, /[ \t,]+/)
+    op = (w[1] == "") ? w[2] : w[1]
+    arg = (w[1] == "") ? w[3] : w[2]
+    if (op == "")
+      continue
+    if (op == ".size" || op == ".section" || op == ".text" || op == ".cfi_endproc")
+      emit_end("end of " fn)
+    if (op ~ /^\./)             # other directives
+      continue
+    if (op ~ /^(ret|retq|ud2)$/)
+      emit_end(op)
+    if (op ~ /^call/)
+      emit_end("call " arg)
+    if (op ~ /^jmp/) {
+      if (!(arg in label))
+        emit_end("tail call " arg)
+      if ((label[arg] + 1) in copied)
+        emit_end("jump back to " arg)
+      i = label[arg]
+      continue
+    }
+    print line[i]
+  }
+  emit_end("end of file")
+}
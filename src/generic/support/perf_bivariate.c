@@ -24,7 +24,7 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
-#define _XOPEN_SOURCE 500   /* for ftruncate */
+#define _GNU_SOURCE   /* for ftruncate, and sched_setaffinity with --threads */
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -52,4 +52,14 @@ function_type_under_test function_under_test;
   accu = p_function_under_test(randoms[2 * i] + 0 * accu, randoms[2 * i + 1])
 #define CALL_THROUGHPUT(i) (p_function_under_test(randoms[2 * i], randoms[2 * i + 1]))
 
+#ifdef CORE_MATH_PROFILE
+/* an empty function, to calibrate the phase profile (see profile_breakdown
+   in perf_common.h) */
+static TYPE_UNDER_TEST __attribute__((noinline))
+profile_noop (TYPE_UNDER_TEST x, TYPE_UNDER_TEST y)
+{
+  return x + y;
+}
+#endif
+
 #include "perf_common.h"
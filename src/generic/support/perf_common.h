@@ -24,6 +24,16 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+#include <pthread.h>
+#include <sched.h>
+#include <dlfcn.h>
+#ifdef __x86_64__
+#include <link.h>
+#endif
+
+#include "perf_dist.h"
+#include "perf_events.h"
+
 int rnd1[] = { FE_TONEAREST, FE_TOWARDZERO, FE_UPWARD, FE_DOWNWARD };
 
 int rnd = 0;
@@ -62,13 +72,725 @@ uint64_t __rdtsc(void) {
 }
 #endif
 
+/* Time stamps around a single call for --histogram: on x86_64, the lfence
+   before rdtsc waits for the previous instructions, and rdtscp followed by
+   lfence waits for the call and prevents the next instructions from
+   starting early. Elsewhere, __rdtsc() is already serializing enough (isb
+   on aarch64, lwsync on powerpc64). */
+#ifdef __x86_64__
+static inline uint64_t
+hist_start (void)
+{
+  _mm_lfence ();
+  uint64_t t = __rdtsc ();
+  _mm_lfence ();
+  return t;
+}
+
+static inline uint64_t
+hist_stop (void)
+{
+  unsigned int aux;
+  uint64_t t = __rdtscp (&aux);
+  _mm_lfence ();
+  return t;
+}
+#else
+#define hist_start() __rdtsc()
+#define hist_stop() __rdtsc()
+#endif
+
+typedef struct {
+  uint64_t cycles;
+  int i;
+} hist_sample_t;
+
+static int
+hist_cmp (const void *a, const void *b)
+{
+  uint64_t x = ((const hist_sample_t *) a)->cycles;
+  uint64_t y = ((const hist_sample_t *) b)->cycles;
+  return (x > y) - (x < y);
+}
+
+/* the p-th percentile of the sorted samples s[0..count-1] */
+static uint64_t
+hist_percentile (const hist_sample_t *s, int count, double p)
+{
+  int k = (int) ((p / 100.0) * count + 0.5);
+  k = (k < 1) ? 0 : (k > count) ? count - 1 : k - 1;
+  return s[k].cycles;
+}
+
+/* sort the samples s[0..count-1], and print their mean and percentiles */
+static void
+hist_summary (hist_sample_t *s, int count)
+{
+  double mean = 0;
+  for (int i = 0; i < count; i++)
+    mean += (double) s[i].cycles;
+  mean /= count;
+  qsort (s, count, sizeof (hist_sample_t), hist_cmp);
+  printf("mean %.1f p50 %lu p90 %lu p99 %lu p99.9 %lu max %lu\n", mean,
+         (unsigned long) hist_percentile (s, count, 50),
+         (unsigned long) hist_percentile (s, count, 90),
+         (unsigned long) hist_percentile (s, count, 99),
+         (unsigned long) hist_percentile (s, count, 99.9),
+         (unsigned long) s[count - 1].cycles);
+}
+
+/* For --histogram: time each call separately, and print the distribution
+   of the cost per input, its percentiles, and the slowest inputs. The cost
+   of an input is the minimum over the repeat passes of the cycles of its
+   call, minus the overhead of an empty measurement (calibrated as a
+   minimum as well), so that interrupts and other noise are filtered out
+   while the slow paths of the function are not. The histogram has one
+   bucket per power of two. The slowest inputs are printed in the format of
+   the .wc files (the arguments separated by commas), so that the lines
+   starting with 0x can be saved and used with --dist file:path. */
+static void
+histogram (TYPE_UNDER_TEST *randoms, int count, int repeat, int slowest,
+           function_type_under_test *p_function_under_test)
+{
+  hist_sample_t *s = malloc (count * sizeof (hist_sample_t));
+  if (s == NULL) {
+    perror("malloc");
+    exit(3);
+  }
+  uint64_t overhead = UINT64_MAX;
+  for (int i = 0; i < 100000; i++) {
+    uint64_t t0 = hist_start ();
+    uint64_t t1 = hist_stop ();
+    if (t1 - t0 < overhead)
+      overhead = t1 - t0;
+  }
+  for (int i = 0; i < count; i++) {
+    s[i].cycles = UINT64_MAX;
+    s[i].i = i;
+  }
+  for (int r = 0; r < repeat; r++) {
+    for (int i = 0; i < count; i++) {
+      uint64_t t0 = hist_start ();
+      CALL_THROUGHPUT(i);
+      uint64_t t1 = hist_stop ();
+      uint64_t c = (t1 - t0 > overhead) ? t1 - t0 - overhead : 0;
+      if (c < s[i].cycles)
+        s[i].cycles = c;
+    }
+  }
+  printf("overhead %lu cycles (subtracted)\n", (unsigned long) overhead);
+  hist_summary (s, count);
+
+  /* bucket 0 holds the costs 0 and 1, bucket 0 < b < 63 the costs in
+     [2^b, 2^(b+1)), and bucket 63 those in [2^63, 2^64-1], which are only
+     reached if the time-stamp counter went backwards */
+  int calls[64] = {0}, cumul = 0;
+  for (int i = 0; i < count; i++) {
+    int b = (s[i].cycles < 2) ? 0 : 63 - __builtin_clzll (s[i].cycles);
+    calls[b]++;
+  }
+  int bmin = 63, bmax = 0, most = 0;
+  for (int b = 0; b < 64; b++)
+    if (calls[b] != 0) {
+      bmin = (b < bmin) ? b : bmin;
+      bmax = b;
+      most = (calls[b] > most) ? calls[b] : most;
+    }
+  printf("%21s %10s %10s %10s\n", "cycles", "calls", "fraction", "cumul");
+  for (int b = bmin; b <= bmax; b++) {
+    cumul += calls[b];
+    uint64_t lo = (b == 0) ? 0 : (uint64_t) 1 << b;
+    uint64_t hi = (b == 63) ? UINT64_MAX : (uint64_t) 1 << (b + 1);
+    printf("[%8llu, %8llu%c %10d %9.5f%% %9.5f%% ",
+           (unsigned long long) lo, (unsigned long long) hi,
+           (b == 63) ? ']' : ')', calls[b],
+           100.0 * calls[b] / count, 100.0 * cumul / count);
+    for (int k = 0; k < (calls[b] * 40 + most - 1) / most; k++)
+      putchar('#');
+    putchar('\n');
+  }
+
+  if (slowest > count)
+    slowest = count;
+  printf("# %d slowest inputs, with their cost in cycles\n", slowest);
+  for (int k = count - 1; k >= count - slowest; k--) {
+    for (unsigned j = 0; j < DIST_ARITY; j++) {
+      TYPE_UNDER_TEST x = randoms[s[k].i * DIST_ARITY + j];
+      if (j != 0)
+        putchar(',');
+      if (sizeof (TYPE_UNDER_TEST) <= sizeof (double))
+        printf("%a", (double) x);
+      else
+        printf("%La", (long double) x);
+    }
+    printf(" # %lu\n", (unsigned long) s[k].cycles);
+  }
+  free (s);
+}
+
+#ifdef __x86_64__
+/* For --cold: the function under test is evaluated as if it were called
+   sporadically, with its code and tables evicted from all cache levels
+   before each call. The evicted lines are those of the loadable segments
+   of the object holding the function, i.e., the perf program itself for
+   core-math (thus the function, its shared kernels and their tables), or
+   the libm for --libc, found with dl_iterate_phdr(). Each line is flushed
+   with clflush; the inputs, on the heap, remain in the cache. The cost of a
+   call is the minimum over the repeat passes of the cycles it takes, minus
+   the overhead of an empty measurement after the same eviction.
+
+   On the first COLD_PROBE_CALLS calls, the lines touched by the call are
+   also detected by flush+reload: after the call, each line of the segments
+   is loaded, and a fast load means the call brought it back (in two of
+   three evaluations, against noise). The lines that the harness itself
+   touches (found by probing after an eviction without call) are not
+   counted. The lines are probed in a random order, against the
+   prefetchers, but the counts remain upper bounds, since a prefetched
+   neighbour of a touched line counts as touched (cachelines.c gives exact
+   counts for the tables). They are reported in bytes per call and over
+   all probed calls, for the code (text), the read-only data (rodata,
+   holding the tables) and the writable data. */
+
+#define COLD_MAX_SEGMENTS 16
+#define COLD_PROBE_CALLS 256
+#define COLD_LINE 64
+
+enum { COLD_TEXT, COLD_RODATA, COLD_DATA };
+
+typedef struct {
+  uintptr_t addr;      /* an address of the object to find */
+  int nseg;
+  uintptr_t start[COLD_MAX_SEGMENTS], end[COLD_MAX_SEGMENTS];
+  int kind[COLD_MAX_SEGMENTS];
+  const char *name;
+} cold_object_t;
+
+static int
+cold_find_object (struct dl_phdr_info *info, size_t size, void *data)
+{
+  cold_object_t *o = data;
+  (void) size;
+  int found = 0;
+  for (int i = 0; i < info->dlpi_phnum; i++) {
+    const ElfW(Phdr) *ph = &info->dlpi_phdr[i];
+    uintptr_t start = info->dlpi_addr + ph->p_vaddr;
+    if (ph->p_type == PT_LOAD && start <= o->addr
+        && o->addr < start + ph->p_memsz)
+      found = 1;
+  }
+  if (!found)
+    return 0;
+  o->nseg = 0;
+  o->name = (info->dlpi_name[0] == '\0') ? "perf" : info->dlpi_name;
+  for (int i = 0; i < info->dlpi_phnum && o->nseg < COLD_MAX_SEGMENTS; i++) {
+    const ElfW(Phdr) *ph = &info->dlpi_phdr[i];
+    if (ph->p_type != PT_LOAD)
+      continue;
+    uintptr_t start = info->dlpi_addr + ph->p_vaddr;
+    o->start[o->nseg] = start & -(uintptr_t) COLD_LINE;
+    o->end[o->nseg] = start + ph->p_memsz;
+    o->kind[o->nseg] = (ph->p_flags & PF_X) ? COLD_TEXT
+      : (ph->p_flags & PF_W) ? COLD_DATA : COLD_RODATA;
+    o->nseg++;
+  }
+  return 1;
+}
+
+static void
+cold_flush (const cold_object_t *o)
+{
+  for (int j = 0; j < o->nseg; j++)
+    for (uintptr_t a = o->start[j]; a < o->end[j]; a += COLD_LINE)
+      _mm_clflush((const void *) a);
+  _mm_mfence();
+}
+
+/* the cycles of a load of the line at a */
+static inline uint64_t
+cold_load (uintptr_t a)
+{
+  uint64_t t0 = hist_start ();
+  (void) *(volatile const char *) a;
+  uint64_t t1 = hist_stop ();
+  return t1 - t0;
+}
+
+static int
+cold_cmp (const void *a, const void *b)
+{
+  uint64_t x = *(const uint64_t *) a, y = *(const uint64_t *) b;
+  return (x > y) - (x < y);
+}
+
+/* a load faster than the returned threshold hits the cache: it is the
+   middle of the median costs of a cached load and of a flushed load */
+static uint64_t
+cold_threshold (uintptr_t a)
+{
+  uint64_t hit[101], miss[101];
+  for (int k = 0; k < 101; k++) {
+    (void) *(volatile const char *) a;
+    hit[k] = cold_load (a);
+    _mm_clflush((const void *) a);
+    _mm_mfence();
+    miss[k] = cold_load (a);
+  }
+  qsort (hit, 101, sizeof (uint64_t), cold_cmp);
+  qsort (miss, 101, sizeof (uint64_t), cold_cmp);
+  return (hit[50] + miss[50]) / 2;
+}
+
+static void
+cold_latency (TYPE_UNDER_TEST *randoms, int count, int repeat,
+              function_type_under_test *p_function_under_test)
+{
+  cold_object_t o = { .addr = (uintptr_t) (void *) p_function_under_test };
+  if (dl_iterate_phdr(cold_find_object, &o) == 0) {
+    fprintf(stderr, "Error, cannot find the object of the function\n");
+    exit(3);
+  }
+  uint64_t bytes[3] = {0};
+  size_t nlines = 0;
+  for (int j = 0; j < o.nseg; j++) {
+    bytes[o.kind[j]] += o.end[j] - o.start[j];
+    nlines += (o.end[j] - o.start[j] + COLD_LINE - 1) / COLD_LINE;
+  }
+  printf("evicted %s: text %lu bytes, rodata %lu bytes, data %lu bytes\n",
+         o.name, (unsigned long) bytes[COLD_TEXT],
+         (unsigned long) bytes[COLD_RODATA], (unsigned long) bytes[COLD_DATA]);
+
+  hist_sample_t *s = malloc(count * sizeof(hist_sample_t));
+  /* line k of the segments, in order, and whether it was touched */
+  uintptr_t *line = malloc(nlines * sizeof(uintptr_t));
+  int *line_kind = malloc(nlines * sizeof(int));
+  char *touched = calloc(nlines, 1);
+  if (s == NULL || line == NULL || line_kind == NULL || touched == NULL) {
+    perror("malloc");
+    exit(3);
+  }
+  size_t n = 0;
+  for (int j = 0; j < o.nseg; j++)
+    for (uintptr_t a = o.start[j]; a < o.end[j]; a += COLD_LINE) {
+      line_kind[n] = o.kind[j];
+      line[n++] = a;
+    }
+
+  uint64_t overhead = UINT64_MAX;
+  for (int i = 0; i < 1000; i++) {
+    cold_flush (&o);
+    uint64_t t0 = hist_start ();
+    uint64_t t1 = hist_stop ();
+    if (t1 - t0 < overhead)
+      overhead = t1 - t0;
+  }
+  uint64_t threshold = cold_threshold (o.end[0] - 1);
+  /* the lines are probed in a random order, against the prefetchers */
+  size_t *order = malloc(nlines * sizeof(size_t));
+  unsigned char *harness = calloc(nlines, 1), *votes = malloc(nlines);
+  if (order == NULL || harness == NULL || votes == NULL) {
+    perror("malloc");
+    exit(3);
+  }
+  uint64_t seed = 0x9e3779b97f4a7c15ull;
+  for (size_t l = 0; l < nlines; l++)
+    order[l] = l;
+  for (size_t l = nlines - 1; l > 0; l--) {
+    seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+    size_t k = (seed >> 33) % (l + 1), t = order[l];
+    order[l] = order[k];
+    order[k] = t;
+  }
+  /* the harness lines are those found in the cache in most of 16 probes
+     after an eviction without call */
+  for (int k = 0; k < 16; k++) {
+    cold_flush (&o);
+    for (size_t j = 0; j < nlines; j++)
+      harness[order[j]] += cold_load (line[order[j]]) < threshold;
+  }
+  uint64_t probed[3] = {0};
+  int nprobe = (count < COLD_PROBE_CALLS) ? count : COLD_PROBE_CALLS;
+  for (int i = 0; i < count; i++) {
+    s[i].cycles = UINT64_MAX;
+    s[i].i = i;
+  }
+  for (int r = 0; r < repeat; r++) {
+    for (int i = 0; i < count; i++) {
+      cold_flush (&o);
+      uint64_t t0 = hist_start ();
+      CALL_THROUGHPUT(i);
+      uint64_t t1 = hist_stop ();
+      uint64_t c = (t1 - t0 > overhead) ? t1 - t0 - overhead : 0;
+      if (c < s[i].cycles)
+        s[i].cycles = c;
+      if (r == 0 && i < nprobe) {
+        /* a line is touched if it is found in the cache after two of
+           three evaluations (after an eviction each), against noise */
+        memset(votes, 0, nlines);
+        for (int k = 0; k < 3; k++) {
+          if (k > 0) {
+            cold_flush (&o);
+            CALL_THROUGHPUT(i);
+          }
+          for (size_t j = 0; j < nlines; j++)
+            votes[order[j]] += cold_load (line[order[j]]) < threshold;
+        }
+        for (size_t l = 0; l < nlines; l++)
+          if (votes[l] >= 2 && harness[l] < 8) {
+            probed[line_kind[l]] += COLD_LINE;
+            touched[l] = 1;
+          }
+      }
+    }
+  }
+
+  uint64_t footprint[3] = {0};
+  for (size_t l = 0; l < nlines; l++)
+    if (touched[l])
+      footprint[line_kind[l]] += COLD_LINE;
+  printf("touched per call: text %.0f bytes, rodata %.0f bytes, "
+         "data %.0f bytes (%d calls)\n",
+         (double) probed[COLD_TEXT] / nprobe,
+         (double) probed[COLD_RODATA] / nprobe,
+         (double) probed[COLD_DATA] / nprobe, nprobe);
+  printf("touched by all calls: text %lu bytes, rodata %lu bytes, "
+         "data %lu bytes\n", (unsigned long) footprint[COLD_TEXT],
+         (unsigned long) footprint[COLD_RODATA],
+         (unsigned long) footprint[COLD_DATA]);
+  printf("overhead %lu cycles (subtracted)\n", (unsigned long) overhead);
+  hist_summary (s, count);
+  free(s);
+  free(line);
+  free(line_kind);
+  free(touched);
+  free(order);
+  free(harness);
+  free(votes);
+}
+#endif
+
+/* For --threads N: thread t is pinned to the t-th CPU allowed for the
+   process, and evaluates its own copy of the inputs (allocated once
+   pinned, thus on its own node), rotated so that it starts at the t-th
+   slice of count/N inputs. All threads start together after a barrier and
+   time their repeat passes with __rdtsc(). The aggregate cost is the time
+   from the first start to the last stop divided by the total number of
+   calls: with perfect scaling, it is the cost of one thread divided by N. */
+typedef struct {
+  int t, nthreads, cpu, count, repeat, latency;
+  TYPE_UNDER_TEST *inputs;
+  function_type_under_test *p_function_under_test;
+  pthread_barrier_t *barrier;
+  uint64_t start, stop;
+} perf_thread_t;
+
+static void *
+perf_thread (void *arg)
+{
+  perf_thread_t *a = arg;
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(a->cpu, &set);
+  if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+    perror("sched_setaffinity");
+    exit(3);
+  }
+  /* the rounding mode is per thread */
+  fesetround(rnd1[rnd]);
+  int count = a->count;
+  int off = (int) ((int64_t) a->t * count / a->nthreads);
+  TYPE_UNDER_TEST *randoms = malloc(count * SAMPLE_SIZE);
+  if (randoms == NULL) {
+    perror("malloc");
+    exit(3);
+  }
+  memcpy(randoms, a->inputs + off * DIST_ARITY, (count - off) * SAMPLE_SIZE);
+  memcpy(randoms + (count - off) * DIST_ARITY, a->inputs, off * SAMPLE_SIZE);
+  function_type_under_test *p_function_under_test = a->p_function_under_test;
+  pthread_barrier_wait(a->barrier);
+  a->start = __rdtsc();
+  if (a->latency) {
+    for (int r = 0; r < a->repeat; r++) {
+      TYPE_UNDER_TEST accu = 0;
+      for (int i = 0; i < count; i++) {
+        CALL_LATENCY(accu, i);
+      }
+    }
+  } else {
+    for (int r = 0; r < a->repeat; r++) {
+      for (int i = 0; i < count; i++) {
+        CALL_THROUGHPUT(i);
+      }
+    }
+  }
+  a->stop = __rdtsc();
+  free(randoms);
+  return NULL;
+}
+
+/* print the cycles/call of each thread, then the aggregate cycles/call */
+static void
+perf_threads (TYPE_UNDER_TEST *randoms, int count, int repeat, int latency,
+              int nthreads, function_type_under_test *p_function_under_test)
+{
+  cpu_set_t allowed;
+  int cpus[CPU_SETSIZE], ncpus = 0;
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+    perror("sched_getaffinity");
+    exit(3);
+  }
+  for (int c = 0; c < CPU_SETSIZE; c++)
+    if (CPU_ISSET(c, &allowed))
+      cpus[ncpus++] = c;
+  if (nthreads > ncpus)
+    fprintf(stderr, "Warning, %d threads on %d CPUs\n", nthreads, ncpus);
+  perf_thread_t *a = calloc(nthreads, sizeof(perf_thread_t));
+  pthread_t *id = calloc(nthreads, sizeof(pthread_t));
+  if (a == NULL || id == NULL) {
+    perror("calloc");
+    exit(3);
+  }
+  pthread_barrier_t barrier;
+  pthread_barrier_init(&barrier, NULL, nthreads);
+  for (int t = 0; t < nthreads; t++) {
+    a[t] = (perf_thread_t) {
+      .t = t, .nthreads = nthreads, .cpu = cpus[t % ncpus], .count = count,
+      .repeat = repeat, .latency = latency, .inputs = randoms,
+      .p_function_under_test = p_function_under_test, .barrier = &barrier };
+    if (pthread_create(&id[t], NULL, perf_thread, &a[t]) != 0) {
+      fprintf(stderr, "Error, cannot create thread %d\n", t);
+      exit(3);
+    }
+  }
+  uint64_t start = UINT64_MAX, stop = 0;
+  for (int t = 0; t < nthreads; t++) {
+    pthread_join(id[t], NULL);
+    start = (a[t].start < start) ? a[t].start : start;
+    stop = (a[t].stop > stop) ? a[t].stop : stop;
+  }
+  for (int t = 0; t < nthreads; t++)
+    printf("thread %d (cpu %d): %.3f cycles/call\n", t, a[t].cpu,
+           (double) (a[t].stop - a[t].start) / ((double) repeat * count));
+  printf("aggregate: %.3f cycles/call (%d threads)\n",
+         (double) (stop - start) / ((double) nthreads * repeat * count),
+         nthreads);
+  pthread_barrier_destroy(&barrier);
+  free(a);
+  free(id);
+}
+
+/* With --lib path (repeatable), the function is also looked up in the
+   shared library path, loaded with dlopen(): first under its name (for
+   example exp in another libm), then as cr_name (for example cr_exp in a
+   shared library of a previous version of core-math). Core-math, the libc
+   and these libraries are timed in turn on the same inputs, for each of
+   the repeat passes, so that a drift of the frequency affects them all
+   alike, and the minimum and median cycles/call over the passes are
+   printed. */
+#define PERF_MAX_LIBS 16
+#define PERF_STR(x) PERF_STR1(x)
+#define PERF_STR1(x) #x
+
+static int
+perf_cmp_double (const void *a, const void *b)
+{
+  double x = *(const double *) a, y = *(const double *) b;
+  return (x > y) - (x < y);
+}
+
+static void
+perf_libs (TYPE_UNDER_TEST *randoms, int count, int repeat, int latency,
+           char **libs, int nlibs)
+{
+  const char *name[PERF_MAX_LIBS + 2] = { "core-math", "libc" };
+  function_type_under_test *f[PERF_MAX_LIBS + 2] =
+    { &cr_function_under_test, &function_under_test };
+  int n = 2;
+  for (int l = 0; l < nlibs; l++) {
+    void *h = dlopen(libs[l], RTLD_NOW | RTLD_LOCAL);
+    if (h == NULL) {
+      fprintf(stderr, "Error, %s\n", dlerror());
+      exit(1);
+    }
+    void *p = dlsym(h, PERF_STR(function_under_test));
+    if (p == NULL)
+      p = dlsym(h, PERF_STR(cr_function_under_test));
+    if (p == NULL) {
+      fprintf(stderr, "%s has neither %s nor %s; skipping\n", libs[l],
+              PERF_STR(function_under_test), PERF_STR(cr_function_under_test));
+      continue;
+    }
+    name[n] = libs[l];
+    f[n++] = (function_type_under_test *) p;
+  }
+  double *t = malloc((size_t) n * repeat * sizeof(double));
+  if (t == NULL) {
+    perror("malloc");
+    exit(3);
+  }
+  for (int r = 0; r < repeat; r++)
+    for (int j = 0; j < n; j++) {
+      function_type_under_test *p_function_under_test = f[j];
+      uint64_t start = __rdtsc();
+      if (latency) {
+        TYPE_UNDER_TEST accu = 0;
+        for (int i = 0; i < count; i++) {
+          CALL_LATENCY(accu, i);
+        }
+      } else {
+        for (int i = 0; i < count; i++) {
+          CALL_THROUGHPUT(i);
+        }
+      }
+      t[j * repeat + r] = (double) (__rdtsc() - start) / count;
+    }
+  printf("%-40s %10s %10s\n", "cycles/call", "min", "median");
+  for (int j = 0; j < n; j++) {
+    qsort(t + j * repeat, repeat, sizeof(double), perf_cmp_double);
+    printf("%-40s %10.3f %10.3f\n", name[j], t[j * repeat],
+           t[j * repeat + repeat / 2]);
+  }
+  free(t);
+}
+
+#include "perf_heatmap.h"
+#include "perf_special.h"
+
+#ifdef CORE_MATH_STATS
+/* Evaluate the function once more on each input, and attribute each call to
+   the last path it hit (see stats.h), or to the fast path when it only hit
+   "calls". With --rdtsc, each call is also timed, minus the cost of reading
+   the time-stamp counter: this includes the counting itself, thus only the
+   differences between paths are meaningful. */
+static void
+stats_breakdown (TYPE_UNDER_TEST *randoms, int count,
+                 function_type_under_test *p_function_under_test,
+                 int show_rdtsc)
+{
+  /* index 0 is the fast path, and index k > 0 the site k-1 */
+  static uint64_t calls[CORE_MATH_STATS_MAX_SITES + 1];
+  static uint64_t cycles[CORE_MATH_STATS_MAX_SITES + 1];
+  uint64_t overhead = UINT64_MAX;
+  for (int i = 0; i < 1000; i++) {
+    uint64_t t0 = __rdtsc();
+    uint64_t t1 = __rdtsc();
+    if (t1 - t0 < overhead)
+      overhead = t1 - t0;
+  }
+  for (int i = 0; i < count; i++) {
+    __cr_stats_last = -1;
+    uint64_t t0 = __rdtsc();
+    CALL_THROUGHPUT(i);
+    uint64_t t1 = __rdtsc();
+    int k = __cr_stats_last + 1;
+    calls[k]++;
+    cycles[k] += (t1 - t0 > overhead) ? t1 - t0 - overhead : 0;
+  }
+  printf("%12s %10s%s  %s\n", "calls", "fraction",
+         show_rdtsc ? " cycles/call" : "", "path");
+  for (int k = 0; k <= __cr_stats_nsites (); k++) {
+    if (calls[k] == 0)
+      continue;
+    printf("%12lu %9.5f%%", (unsigned long) calls[k],
+           100.0 * (double) calls[k] / count);
+    if (show_rdtsc)
+      printf(" %11.1f", (double) cycles[k] / calls[k]);
+    printf("  %s\n", __cr_stats_name (k - 1));
+  }
+}
+#endif
+
+#ifdef CORE_MATH_PROFILE
+/* Run the function repeat times on each input, between the markers of the
+   phases "(entry)" and "(outside)", resetting the counters first. */
+static void
+profile_run (TYPE_UNDER_TEST *randoms, int count, int repeat,
+             function_type_under_test *p_function_under_test)
+{
+  memset (__cr_profile_cycles, 0, sizeof (__cr_profile_cycles));
+  memset (__cr_profile_hits, 0, sizeof (__cr_profile_hits));
+  for (int r = 0; r < repeat; r++)
+    for (int i = 0; i < count; i++) {
+      __cr_profile_mark (0);
+      CALL_THROUGHPUT(i);
+      __cr_profile_mark (1);
+    }
+}
+
+/* Print the cycles per call of each phase marked by CORE_MATH_PHASE (see
+   profile.h), evaluating the function repeat times more on each input.
+   The same loop over an empty function gives the cost of the markers
+   around a call, which is subtracted from "(entry)", and two consecutive
+   markers give the cost of a marker, which is subtracted from the other
+   phases. The markers serialize the phases, which the processor would
+   otherwise overlap: the absolute cycles remain above those of a call
+   without markers, and the shares are the figures to compare. */
+static void
+profile_breakdown (TYPE_UNDER_TEST *randoms, int count, int repeat,
+                   function_type_under_test *p_function_under_test)
+{
+  profile_run (randoms, count, repeat, p_function_under_test);
+  int nphases = __cr_profile_nphases ();
+  if (nphases <= 2) {
+    fprintf (stderr, "Error, no phase markers in this function"
+             " (see CORE_MATH_PHASE in profile.h)\n");
+    exit (1);
+  }
+  unsigned long long cycles_run[CORE_MATH_PROFILE_MAX_PHASES];
+  unsigned long long hits_run[CORE_MATH_PROFILE_MAX_PHASES];
+  memcpy (cycles_run, __cr_profile_cycles, sizeof (cycles_run));
+  memcpy (hits_run, __cr_profile_hits, sizeof (hits_run));
+
+  /* the volatile pointer keeps the calls to the empty function */
+  function_type_under_test *volatile noop = profile_noop;
+  profile_run (randoms, count, repeat, noop);
+  double call_overhead = (double) __cr_profile_cycles[0] / __cr_profile_hits[0];
+  uint64_t overhead = UINT64_MAX;
+  for (int i = 0; i < 1000; i++) {
+    uint64_t c = __cr_profile_cycles[0];
+    __cr_profile_mark (0);
+    __cr_profile_mark (1);
+    if (__cr_profile_cycles[0] - c < overhead)
+      overhead = __cr_profile_cycles[0] - c;
+  }
+
+  double calls = (double) repeat * count, total = 0;
+  double cycles[CORE_MATH_PROFILE_MAX_PHASES];
+  for (int k = 0; k < nphases; k++) {
+    double o = hits_run[k] * ((k == 0) ? call_overhead : (double) overhead);
+    cycles[k] = (cycles_run[k] > o) ? cycles_run[k] - o : 0;
+    if (k != 1)
+      total += cycles[k];
+  }
+  printf("empty call: %.2f cycles, marker: %lu cycles (subtracted)\n",
+         call_overhead, (unsigned long) overhead);
+  printf("%10s %11s %8s  %s\n", "calls", "cycles/call", "share", "phase");
+  for (int k = 0; k < nphases; k++) {
+    if (k == 1 || hits_run[k] == 0)
+      continue;
+    printf("%9.3f%% %11.2f %7.2f%%  %s\n",
+           100.0 * hits_run[k] / calls, cycles[k] / calls,
+           (total > 0) ? 100.0 * cycles[k] / total : 0.0,
+           __cr_profile_name (k));
+  }
+  printf("%10s %11.2f  (inflated by the markers, compare the shares)\n",
+         "total", total / calls);
+}
+#endif
+
 int
 main (int argc, char *argv[])
 {
   int count = 1000000, repeat = 1;
   int reference = 0, latency = 0, show_rdtsc = 0;
+  int show_histogram = 0, slowest = 20, nthreads = 0, cold = 0;
+  int counters = 0, nlibs = 0, show_special = 0;
+  char *heatmap_path = NULL;
+  hm_options_t hm = { .cells = 0, .signs = 0, .cell_count = 1000,
+                      .e0 = HM_EMIN, .e1 = HM_EMAX };
+  char *libs[PERF_MAX_LIBS];
   function_type_under_test *p_function_under_test = &cr_function_under_test;
   char *file = NULL;
+  dist_t dist = { .kind = DIST_DEFAULT };
 
   while (argc >= 2)
     {
@@ -114,12 +836,109 @@ main (int argc, char *argv[])
           argc --;
           argv ++;
         }
+      else if (strcmp (argv[1], "--histogram") == 0)
+        {
+          show_histogram = 1;
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--slowest") == 0)
+        {
+          argc --;
+          argv ++;
+          slowest = atoi(argv[1]);
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--cold") == 0)
+        {
+          cold = 1;
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--counters") == 0)
+        {
+          counters = 1;
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--threads") == 0)
+        {
+          argc --;
+          argv ++;
+          nthreads = atoi(argv[1]);
+          argc --;
+          argv ++;
+        }
       else if (strcmp (argv[1], "--libc") == 0)
         {
           p_function_under_test = &function_under_test;
           argc --;
           argv ++;
         }
+      else if (strcmp (argv[1], "--special") == 0)
+        {
+          show_special = 1;
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--heatmap") == 0)
+        {
+          argc --;
+          argv ++;
+          heatmap_path = argv[1];
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--cells") == 0)
+        {
+          argc --;
+          argv ++;
+          hm.cells = atoi(argv[1]);
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--cell-count") == 0)
+        {
+          argc --;
+          argv ++;
+          hm.cell_count = atoi(argv[1]);
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--binades") == 0)
+        {
+          argc --;
+          argv ++;
+          if (sscanf (argv[1], "%d,%d", &hm.e0, &hm.e1) != 2
+              || hm.e0 < HM_EMIN || hm.e1 > HM_EMAX || hm.e0 >= hm.e1)
+            {
+              fprintf (stderr, "Error, invalid --binades %s, the binades "
+                       "are within %d,%d\n", argv[1], HM_EMIN, HM_EMAX);
+              exit (1);
+            }
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--signs") == 0)
+        {
+          hm.signs = 1;
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--lib") == 0)
+        {
+          argc --;
+          argv ++;
+          if (nlibs == PERF_MAX_LIBS)
+            {
+              fprintf (stderr, "Error, more than %d --lib\n", PERF_MAX_LIBS);
+              exit (1);
+            }
+          libs[nlibs++] = argv[1];
+          argc --;
+          argv ++;
+        }
       else if (strcmp (argv[1], "--file") == 0)
         {
           argc --;
@@ -128,6 +947,14 @@ main (int argc, char *argv[])
           argc --;
           argv ++;
         }
+      else if (strcmp (argv[1], "--dist") == 0)
+        {
+          argc --;
+          argv ++;
+          dist_parse (&dist, argv[1]);
+          argc --;
+          argv ++;
+        }
       else if (strcmp (argv[1], "--count") == 0)
         {
           argc --;
@@ -151,12 +978,48 @@ main (int argc, char *argv[])
         }
     }
 
+  if (heatmap_path != NULL) {
+    if (hm.cells <= 0)
+      hm.cells = (DIST_ARITY == 2) ? 24 : 64;
+    hm.repeat = repeat;
+    if (hm.cell_count <= 0) {
+      fprintf(stderr, "Error, invalid --cell-count\n");
+      exit(1);
+    }
+    fesetround(rnd1[rnd]);
+    heatmap (heatmap_path, &hm, p_function_under_test);
+    return 0;
+  }
+
+  if (show_special) {
+    if (count <= 0 || repeat <= 0) {
+      fprintf(stderr, "Error, invalid --count or --repeat\n");
+      exit(1);
+    }
+    fesetround(rnd1[rnd]);
+    special (count, repeat, &dist, p_function_under_test);
+    return 0;
+  }
+
   if (file == NULL) {
     fprintf(stderr, "--file <file> is mandatory\n");
     fflush(stderr);
     exit(2);
   }
 
+  if (nthreads < 0 || show_histogram + (nthreads > 0) + cold + counters
+      + (nlibs > 0) > 1) {
+    fprintf(stderr, "Error, invalid --threads, or more than one of "
+            "--histogram, --threads, --cold, --counters and --lib\n");
+    exit(1);
+  }
+#ifndef __x86_64__
+  if (cold) {
+    fprintf(stderr, "Error, --cold is only supported on x86_64\n");
+    exit(1);
+  }
+#endif
+
   fesetround(rnd1[rnd]);
   if (reference) {
     int fd = open(file, O_CREAT | O_RDWR, 00644);
@@ -173,9 +1036,7 @@ main (int argc, char *argv[])
       perror("mmap");
       exit(3);
     }
-    for (unsigned int i = 0; i < count * SAMPLE_SIZE / sizeof(TYPE_UNDER_TEST); i++) {
-      randoms[i] = random_under_test();
-    }
+    dist_fill (randoms, count, &dist);
     msync(randoms, count * SAMPLE_SIZE, MS_SYNC);
     munmap(randoms, count * SAMPLE_SIZE);
     close(fd);
@@ -196,8 +1057,29 @@ main (int argc, char *argv[])
       exit(3);
     }
     memcpy(randoms, mmaped_randoms, count * SAMPLE_SIZE);
+    /* the distribution of the inputs, as told by --dist */
+    fprintf(stderr, "inputs: %s, ", file);
+    dist_print (stderr, &dist);
+    fprintf(stderr, "\n");
+    /* with --counters, the counts include the loop around the calls */
+    perf_counters_t c;
+    if (counters) {
+      perf_counters_open (&c);
+      perf_counters_start (&c);
+    }
     uint64_t start = __rdtsc();
-    if (latency) {
+    if (show_histogram) {
+      histogram (randoms, count, repeat, slowest, p_function_under_test);
+#ifdef __x86_64__
+    } else if (cold) {
+      cold_latency (randoms, count, repeat, p_function_under_test);
+#endif
+    } else if (nlibs > 0) {
+      perf_libs (randoms, count, repeat, latency, libs, nlibs);
+    } else if (nthreads > 0) {
+      perf_threads (randoms, count, repeat, latency, nthreads,
+                    p_function_under_test);
+    } else if (latency) {
       for (int r = 0; r < repeat; r++) {
         TYPE_UNDER_TEST accu = 0;
         for (int i = 0; i < count; i++) {
@@ -212,9 +1094,22 @@ main (int argc, char *argv[])
       }
     }
     uint64_t stop = __rdtsc();
-    if (show_rdtsc) {
+    if (counters) {
+      perf_counters_stop (&c);
+      perf_counters_close (&c);
+    }
+    if (show_rdtsc && !show_histogram && nthreads == 0 && !cold
+        && nlibs == 0) {
       printf("%.3f\n", (double) (stop - start) / (repeat * count));
     }
+    if (counters)
+      perf_counters_print (&c, (double) repeat * count);
+#ifdef CORE_MATH_STATS
+    stats_breakdown (randoms, count, p_function_under_test, show_rdtsc);
+#endif
+#ifdef CORE_MATH_PROFILE
+    profile_breakdown (randoms, count, repeat, p_function_under_test);
+#endif
     munmap(mmaped_randoms, count * sizeof(TYPE_UNDER_TEST));
     close(fd);
   }
@@ -0,0 +1,417 @@
+/* Compare two results files of perf.sh/perf-all.sh (CORE_MATH_RESULTS).
+
+Copyright (c) 2025 The CORE-MATH Authors.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* Usage: perf_compare [--all] [--alpha a] [--threshold t] old.csv new.csv
+
+   Each line of a results file (after the header) has the fields function,
+   type, impl, mode, metric, dist, args, compiler, cflags, cpu, glibc and
+   trials, the last one being the cycles/call of each trial separated by
+   ';'. The rows of old.csv and new.csv with the same function, type, impl,
+   mode, metric, dist and args are compared (when a file has several rows
+   with the same key, for example after appending two runs to it, only the
+   last one is kept, with a warning):
+
+   - the Mann-Whitney U test (normal approximation with tie correction)
+     gives the probability p that both sets of trials come from the same
+     distribution;
+   - a bootstrap (2000 resamplings of both sets, with a fixed seed) gives
+     a 95% confidence interval of the ratio of the medians new/old.
+
+   A row is a regression when p < alpha/m (Bonferroni correction over the m
+   compared rows, alpha = 0.05 by default) and the whole interval is above
+   1 + t (t = 0.01 by default), and an improvement in the symmetric case.
+   Only these rows are printed, or all with --all. The exit status is 1 if
+   there is a regression. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#define NFIELDS 12
+#define TRIALS 11     /* index of the trials field */
+#define NKEYS 7       /* function, type, impl, mode, metric, dist, args */
+#define BOOTSTRAP 2000
+
+static const char *field_names[NFIELDS] = {
+  "function", "type", "impl", "mode", "metric", "dist", "args", "compiler",
+  "cflags", "cpu", "glibc", "trials"
+};
+
+typedef struct {
+  char *field[NFIELDS];
+  double *t; /* trials */
+  int n;
+  int superseded; /* by a later row with the same key */
+} row_t;
+
+typedef struct {
+  row_t *row;
+  int n, size;
+} results_t;
+
+/* Split a line into NFIELDS fields, in place, where a field may be quoted
+   with "" for a quote. Return 0 if the line does not have NFIELDS fields. */
+static int
+split (char *s, char **field)
+{
+  int k = 0;
+  while (k < NFIELDS)
+    {
+      char *out = s;
+      field[k++] = s;
+      if (*s == '"')
+        {
+          for (s++; *s != '\0'; s++)
+            {
+              if (*s == '"' && s[1] == '"')
+                s++;
+              else if (*s == '"')
+                {
+                  s++;
+                  break;
+                }
+              *out++ = *s;
+            }
+        }
+      else
+        for (; *s != ',' && *s != '\n' && *s != '\0'; s++)
+          *out++ = *s;
+      char c = *s;
+      *out = '\0';
+      if (c != ',')
+        break;
+      s++;
+    }
+  return k == NFIELDS;
+}
+
+static void
+read_results (results_t *r, const char *path)
+{
+  FILE *f = fopen (path, "r");
+  if (f == NULL)
+    {
+      perror (path);
+      exit (2);
+    }
+  char *line = NULL;
+  size_t size = 0;
+  int lineno = 0;
+  r->row = NULL;
+  r->n = r->size = 0;
+  while (getline (&line, &size, f) != -1)
+    {
+      lineno++;
+      if (lineno == 1 && strncmp (line, "function,", 9) == 0)
+        continue; /* header */
+      row_t x;
+      char *s = strdup (line);
+      if (s == NULL || !split (s, x.field))
+        {
+          fprintf (stderr, "%s:%d: expected %d fields\n", path, lineno,
+                   NFIELDS);
+          exit (2);
+        }
+      x.n = 0;
+      x.t = malloc ((strlen (x.field[TRIALS]) / 2 + 1) * sizeof (double));
+      for (char *p = x.field[TRIALS]; *p != '\0';)
+        {
+          char *end;
+          double v = strtod (p, &end);
+          if (end == p)
+            break;
+          x.t[x.n++] = v;
+          p = (*end == ';') ? end + 1 : end;
+        }
+      if (x.n == 0)
+        {
+          fprintf (stderr, "%s:%d: no trials\n", path, lineno);
+          exit (2);
+        }
+      if (r->n == r->size)
+        {
+          r->size = 2 * r->size + 64;
+          r->row = realloc (r->row, r->size * sizeof (row_t));
+          if (r->row == NULL)
+            {
+              perror ("realloc");
+              exit (2);
+            }
+        }
+      r->row[r->n++] = x;
+    }
+  free (line);
+  fclose (f);
+}
+
+static int
+same_key (const row_t *a, const row_t *b)
+{
+  for (int k = 0; k < NKEYS; k++)
+    if (strcmp (a->field[k], b->field[k]) != 0)
+      return 0;
+  return 1;
+}
+
+/* Mark the rows of r followed by a row with the same key, and warn about
+   them. */
+static void
+mark_duplicates (results_t *r, const char *path)
+{
+  int dups = 0;
+  for (int i = 0; i < r->n; i++)
+    {
+      r->row[i].superseded = 0;
+      for (int j = i + 1; j < r->n && !r->row[i].superseded; j++)
+        r->row[i].superseded = same_key (&r->row[i], &r->row[j]);
+      dups += r->row[i].superseded;
+    }
+  if (dups > 0)
+    fprintf (stderr, "Warning, %d rows of %s have the key of a later row, "
+             "which is used instead\n", dups, path);
+}
+
+static int
+cmp_double (const void *a, const void *b)
+{
+  double x = *(const double *) a, y = *(const double *) b;
+  return (x > y) - (x < y);
+}
+
+/* median of t[0..n-1], which is sorted in place */
+static double
+median (double *t, int n)
+{
+  qsort (t, n, sizeof (double), cmp_double);
+  return (n % 2) ? t[n / 2] : (t[n / 2 - 1] + t[n / 2]) / 2;
+}
+
+/* Two-sided p-value of the Mann-Whitney U test of samples a and b. */
+static double
+mann_whitney (const double *a, int na, const double *b, int nb)
+{
+  int n = na + nb;
+  struct { double v; int from_a; } *x = malloc (n * sizeof (*x));
+  for (int i = 0; i < na; i++)
+    x[i].v = a[i], x[i].from_a = 1;
+  for (int i = 0; i < nb; i++)
+    x[na + i].v = b[i], x[na + i].from_a = 0;
+  /* insertion sort: the samples are small */
+  for (int i = 1; i < n; i++)
+    for (int j = i; j > 0 && x[j - 1].v > x[j].v; j--)
+      {
+        __typeof__ (*x) tmp = x[j];
+        x[j] = x[j - 1];
+        x[j - 1] = tmp;
+      }
+  double ra = 0, ties = 0;
+  for (int i = 0; i < n;)
+    {
+      int j = i;
+      while (j < n && x[j].v == x[i].v)
+        j++;
+      double rank = (i + 1 + j) / 2.0; /* average rank of x[i..j-1] */
+      for (int k = i; k < j; k++)
+        if (x[k].from_a)
+          ra += rank;
+      double t = j - i;
+      ties += t * t * t - t;
+      i = j;
+    }
+  free (x);
+  double u = ra - na * (na + 1) / 2.0;
+  double mu = na * nb / 2.0;
+  double var = na * nb / 12.0 * ((n + 1) - ties / ((double) n * (n - 1)));
+  if (var <= 0)
+    return 1;
+  double z = fabs (u - mu);
+  z = (z > 0.5) ? (z - 0.5) / sqrt (var) : 0; /* continuity correction */
+  return erfc (z / sqrt (2));
+}
+
+static uint64_t seed = 0x9e3779b97f4a7c15;
+
+static uint64_t
+xorshift (void)
+{
+  seed ^= seed << 13;
+  seed ^= seed >> 7;
+  seed ^= seed << 17;
+  return seed;
+}
+
+/* 95% bootstrap confidence interval [lo,hi] of median(b)/median(a) */
+static void
+bootstrap (const double *a, int na, const double *b, int nb, double *lo,
+           double *hi)
+{
+  double *ratio = malloc (BOOTSTRAP * sizeof (double));
+  double *sa = malloc (na * sizeof (double));
+  double *sb = malloc (nb * sizeof (double));
+  for (int r = 0; r < BOOTSTRAP; r++)
+    {
+      for (int i = 0; i < na; i++)
+        sa[i] = a[xorshift () % na];
+      for (int i = 0; i < nb; i++)
+        sb[i] = b[xorshift () % nb];
+      ratio[r] = median (sb, nb) / median (sa, na);
+    }
+  qsort (ratio, BOOTSTRAP, sizeof (double), cmp_double);
+  *lo = ratio[(int) (0.025 * BOOTSTRAP)];
+  *hi = ratio[(int) (0.975 * BOOTSTRAP) - 1];
+  free (ratio);
+  free (sa);
+  free (sb);
+}
+
+int
+main (int argc, char *argv[])
+{
+  double alpha = 0.05, threshold = 0.01;
+  int all = 0;
+
+  while (argc >= 2 && strncmp (argv[1], "--", 2) == 0)
+    {
+      if (strcmp (argv[1], "--all") == 0)
+        {
+          all = 1;
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--alpha") == 0 && argc >= 3)
+        {
+          alpha = atof (argv[2]);
+          argc -= 2;
+          argv += 2;
+        }
+      else if (strcmp (argv[1], "--threshold") == 0 && argc >= 3)
+        {
+          threshold = atof (argv[2]);
+          argc -= 2;
+          argv += 2;
+        }
+      else
+        {
+          fprintf (stderr, "Error, unknown option %s\n", argv[1]);
+          exit (2);
+        }
+    }
+  if (argc != 3)
+    {
+      fprintf (stderr, "Usage: perf_compare [--all] [--alpha a] "
+               "[--threshold t] old.csv new.csv\n");
+      exit (2);
+    }
+
+  results_t old, new;
+  read_results (&old, argv[1]);
+  read_results (&new, argv[2]);
+  mark_duplicates (&old, argv[1]);
+  mark_duplicates (&new, argv[2]);
+
+  /* the row of old matching each row of new, and the rows only in one of
+     them, leaving out the superseded rows */
+  int *match = malloc ((new.n + 1) * sizeof (int)), m = 0;
+  char *matched = calloc (old.n + 1, 1);
+  int only_old = 0, only_new = 0;
+  for (int j = 0; j < new.n; j++)
+    {
+      match[j] = -1;
+      if (new.row[j].superseded)
+        continue;
+      for (int i = 0; i < old.n && match[j] < 0; i++)
+        if (!old.row[i].superseded && same_key (&old.row[i], &new.row[j]))
+          match[j] = i;
+      if (match[j] >= 0)
+        {
+          matched[match[j]] = 1;
+          m++;
+        }
+      else
+        only_new++;
+    }
+  for (int i = 0; i < old.n; i++)
+    only_old += !old.row[i].superseded && !matched[i];
+
+  /* comparing runs on different settings is probably a mistake */
+  for (int k = NKEYS; k < TRIALS; k++)
+    for (int j = 0; j < new.n; j++)
+      if (match[j] >= 0
+          && strcmp (old.row[match[j]].field[k], new.row[j].field[k]) != 0)
+        {
+          fprintf (stderr, "Warning, the %s differs: '%s' and '%s'\n",
+                   field_names[k], old.row[match[j]].field[k],
+                   new.row[j].field[k]);
+          break;
+        }
+
+  printf ("%-10s %-8s %-10s %-12s %10s %10s %8s %19s %9s\n", "function",
+          "type", "impl", "mode", "old", "new", "change", "95% interval",
+          "p");
+  int regressions = 0, improvements = 0;
+  for (int j = 0; j < new.n; j++)
+    {
+      if (match[j] < 0)
+        continue;
+      row_t *a = &old.row[match[j]], *b = &new.row[j];
+      double p = mann_whitney (a->t, a->n, b->t, b->n);
+      double lo, hi;
+      bootstrap (a->t, a->n, b->t, b->n, &lo, &hi);
+      double ma = median (a->t, a->n), mb = median (b->t, b->n);
+      const char *flag = "";
+      if (p < alpha / m && lo > 1 + threshold)
+        {
+          flag = "REGRESSION";
+          regressions++;
+        }
+      else if (p < alpha / m && hi < 1 - threshold)
+        {
+          flag = "improvement";
+          improvements++;
+        }
+      if (!all && *flag == '\0')
+        continue;
+      char mode[64];
+      snprintf (mode, sizeof (mode), "%s/%s", b->field[3], b->field[4]);
+      printf ("%-10s %-8s %-10s %-12s %10.3f %10.3f %+7.2f%% "
+              "[%+7.2f%%,%+7.2f%%] %9.2e %s", b->field[0], b->field[1],
+              b->field[2], mode, ma, mb, 100 * (mb / ma - 1),
+              100 * (lo - 1), 100 * (hi - 1), p, flag);
+      /* the distribution and the options, unless the default ones */
+      if (strcmp (b->field[5], "default") != 0 || *b->field[6] != '\0')
+        printf (" (%s%s%s)", b->field[5], (*b->field[6] != '\0') ? " " : "",
+                b->field[6]);
+      printf ("\n");
+    }
+  printf ("%d rows compared (%d only in %s, %d only in %s): "
+          "%d regressions, %d improvements\n", m, only_old, argv[1],
+          only_new, argv[2], regressions, improvements);
+  free (match);
+  free (matched);
+  return regressions > 0;
+}
@@ -0,0 +1,313 @@
+/* Distributions of the inputs of the performance programs.
+
+Copyright (c) 2025 The CORE-MATH Authors.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* By default, perf --reference samples the inputs with random_under_test()
+   (see src/generic/$NAME/random_under_test.h). With --dist SPEC, they are
+   sampled from SPEC instead:
+   - uniform:a,b       uniform in [a,b];
+   - loguniform        log-uniform over the positive normal numbers;
+   - loguniform:a,b    log-uniform in [a,b], where 0 < a < b;
+   - allbits           uniform over the bit patterns, thus including
+                       negative numbers, subnormals, infinities and NaNs;
+   - nearhard[:path]   the inputs of the worst-case file path (by default
+                       $NAME.wc, in the directory of the function), each
+                       randomly perturbed by at most NEARHARD_ULPS ulps;
+   - file:path         the inputs of path, in the same format as the .wc
+                       files (one input per line, the arguments separated
+                       by commas), repeated if needed;
+   - worst             the finite inputs of $NAME.wc, unperturbed, which
+                       mostly take the accurate path (see perf-worst.sh);
+                       the special values of the .wc files are left out,
+                       since with --latency a NaN or infinite argument
+                       would propagate to all the next calls.
+   For a bivariate function, uniform, loguniform and allbits sample both
+   arguments independently, while nearhard, file and worst take pairs of
+   arguments from the file. The distribution is printed on stderr, with
+   its bounds or file, when the inputs are generated, and with the file of
+   inputs in each timing run (which is only told the distribution by
+   --dist, as perf.sh does), so that the timings remain attached to the
+   inputs they were measured on. */
+
+#include <math.h>
+#include <float.h>
+
+#define DIST_ARITY (SAMPLE_SIZE / sizeof (TYPE_UNDER_TEST))
+
+#define NEARHARD_ULPS 4
+
+#define DIST_STR(x) DIST_STR1(x)
+#define DIST_STR1(x) #x
+
+enum { DIST_DEFAULT, DIST_UNIFORM, DIST_LOGUNIFORM, DIST_ALLBITS,
+       DIST_NEARHARD, DIST_FILE, DIST_WORST };
+
+typedef struct {
+  int kind;
+  long double a, b;  /* bounds for uniform and loguniform */
+  const char *spec;  /* as given to --dist */
+  const char *path;  /* for nearhard, file and worst */
+} dist_t;
+
+static void
+dist_error (const char *spec)
+{
+  fprintf (stderr, "Error, invalid distribution %s\n", spec);
+  exit (1);
+}
+
+/* parse "a,b" into d->a and d->b */
+static void
+dist_parse_bounds (dist_t *d, const char *s)
+{
+  char *end;
+  d->a = strtold (s, &end);
+  if (end == s || *end != ',')
+    dist_error (d->spec);
+  s = end + 1;
+  d->b = strtold (s, &end);
+  if (end == s || *end != '\0' || !(d->a < d->b))
+    dist_error (d->spec);
+}
+
+static void
+dist_parse (dist_t *d, const char *spec)
+{
+  d->spec = spec;
+  if (strncmp (spec, "uniform:", 8) == 0)
+    {
+      d->kind = DIST_UNIFORM;
+      dist_parse_bounds (d, spec + 8);
+    }
+  else if (strcmp (spec, "loguniform") == 0)
+    {
+      d->kind = DIST_LOGUNIFORM;
+      if (sizeof (TYPE_UNDER_TEST) == sizeof (float))
+        d->a = FLT_MIN, d->b = FLT_MAX;
+      else if (sizeof (TYPE_UNDER_TEST) == sizeof (double))
+        d->a = DBL_MIN, d->b = DBL_MAX;
+      else
+        d->a = LDBL_MIN, d->b = LDBL_MAX;
+    }
+  else if (strncmp (spec, "loguniform:", 11) == 0)
+    {
+      d->kind = DIST_LOGUNIFORM;
+      dist_parse_bounds (d, spec + 11);
+      if (!(d->a > 0))
+        dist_error (spec);
+    }
+  else if (strcmp (spec, "allbits") == 0)
+    d->kind = DIST_ALLBITS;
+  else if (strcmp (spec, "nearhard") == 0)
+    {
+      d->kind = DIST_NEARHARD;
+      d->path = DIST_STR(function_under_test) ".wc";
+    }
+  else if (strncmp (spec, "nearhard:", 9) == 0 && spec[9] != '\0')
+    {
+      d->kind = DIST_NEARHARD;
+      d->path = spec + 9;
+    }
+  else if (strcmp (spec, "worst") == 0)
+    {
+      d->kind = DIST_WORST;
+      d->path = DIST_STR(function_under_test) ".wc";
+    }
+  else if (strncmp (spec, "file:", 5) == 0 && spec[5] != '\0')
+    {
+      d->kind = DIST_FILE;
+      d->path = spec + 5;
+    }
+  else
+    dist_error (spec);
+}
+
+/* print on f the distribution d, with its bounds or its file */
+static void
+dist_print (FILE *f, const dist_t *d)
+{
+  switch (d->kind)
+    {
+    case DIST_UNIFORM:
+      fprintf (f, "%s (uniform in [%.21Lg,%.21Lg])", d->spec, d->a, d->b);
+      break;
+    case DIST_LOGUNIFORM:
+      fprintf (f, "%s (log-uniform in [%.21Lg,%.21Lg])", d->spec, d->a, d->b);
+      break;
+    case DIST_NEARHARD:
+      fprintf (f, "%s (%s, perturbed by at most %d ulps)", d->spec, d->path,
+               NEARHARD_ULPS);
+      break;
+    case DIST_FILE:
+      fprintf (f, "%s (%s)", d->spec, d->path);
+      break;
+    case DIST_WORST:
+      fprintf (f, "%s (the finite inputs of %s)", d->spec, d->path);
+      break;
+    case DIST_ALLBITS:
+      fprintf (f, "%s", d->spec);
+      break;
+    default:
+      fprintf (f, "default (random_under_test)");
+    }
+}
+
+/* uniform in [0,1), with 62 random bits */
+static long double
+dist_random01 (void)
+{
+  long double hi = rand () & 0x7fffffff, lo = rand () & 0x7fffffff;
+  return (hi * 0x1p31L + lo) * 0x1p-62L;
+}
+
+/* random bytes: for long double, the padding and the explicit bit of the
+   significand are random too */
+static TYPE_UNDER_TEST
+dist_allbits (void)
+{
+  union { TYPE_UNDER_TEST x; unsigned char c[sizeof (TYPE_UNDER_TEST)]; } v;
+  for (unsigned i = 0; i < sizeof (v.c); i++)
+    v.c[i] = rand () >> 8;
+  return v.x;
+}
+
+/* move x by k ulps, with |k| <= NEARHARD_ULPS */
+static TYPE_UNDER_TEST
+dist_perturb (TYPE_UNDER_TEST x)
+{
+  int k = rand () % (2 * NEARHARD_ULPS + 1) - NEARHARD_ULPS;
+  for (; k != 0; k += (k > 0) ? -1 : 1)
+    {
+      if (sizeof (TYPE_UNDER_TEST) == sizeof (float))
+        x = nextafterf (x, (k > 0) ? INFINITY : -INFINITY);
+      else if (sizeof (TYPE_UNDER_TEST) == sizeof (double))
+        x = nextafter (x, (k > 0) ? INFINITY : -INFINITY);
+      else
+        x = nextafterl (x, (k > 0) ? INFINITY : -INFINITY);
+    }
+  return x;
+}
+
+/* Read the inputs of path into *t, and return their number (each input
+   has DIST_ARITY arguments). Comments, empty lines and the entries that
+   strtold() does not recognize (such as snan) are skipped, as well as the
+   entries with an infinite or NaN argument if finite_only is set. */
+static size_t
+dist_read (TYPE_UNDER_TEST **t, const char *path, int finite_only)
+{
+  FILE *fp = fopen (path, "r");
+  if (fp == NULL) {
+    perror (path);
+    exit (3);
+  }
+  size_t n = 0, size = 0;
+  char buf[1024];
+  *t = NULL;
+  while (fgets (buf, sizeof (buf), fp) != NULL)
+    {
+      TYPE_UNDER_TEST v[DIST_ARITY];
+      char *s = buf, *end;
+      unsigned i;
+      if (buf[0] == '#')
+        continue;
+      for (i = 0; i < DIST_ARITY; i++)
+        {
+          v[i] = strtold (s, &end);
+          if (end == s || (finite_only && !isfinite (v[i])))
+            break;
+          s = (*end == ',') ? end + 1 : end;
+        }
+      if (i < DIST_ARITY)
+        continue;
+      if (n == size)
+        {
+          size = (size == 0) ? 1024 : 2 * size;
+          *t = realloc (*t, size * SAMPLE_SIZE);
+          if (*t == NULL) {
+            perror ("realloc");
+            exit (3);
+          }
+        }
+      memcpy (*t + n * DIST_ARITY, v, SAMPLE_SIZE);
+      n++;
+    }
+  fclose (fp);
+  if (n == 0) {
+    fprintf (stderr, "Error, no input in %s\n", path);
+    exit (1);
+  }
+  return n;
+}
+
+/* fill randoms with count inputs of DIST_ARITY arguments drawn from d */
+static void
+dist_fill (TYPE_UNDER_TEST *randoms, size_t count, const dist_t *d)
+{
+  if (d->kind == DIST_NEARHARD || d->kind == DIST_FILE
+      || d->kind == DIST_WORST)
+    {
+      TYPE_UNDER_TEST *t;
+      size_t n = dist_read (&t, d->path, d->kind == DIST_WORST);
+      for (size_t i = 0; i < count; i++)
+        {
+          size_t j = (d->kind != DIST_NEARHARD) ? i % n
+            : (size_t) (dist_random01 () * n);
+          for (unsigned k = 0; k < DIST_ARITY; k++)
+            {
+              TYPE_UNDER_TEST x = t[j * DIST_ARITY + k];
+              randoms[i * DIST_ARITY + k] =
+                (d->kind == DIST_NEARHARD) ? dist_perturb (x) : x;
+            }
+        }
+      free (t);
+      fprintf (stderr, "inputs: %s (%zu entries in %s)\n", d->spec, n,
+               d->path);
+      return;
+    }
+  long double la = 0, lb = 0;
+  if (d->kind == DIST_LOGUNIFORM)
+    {
+      la = log2l (d->a);
+      lb = log2l (d->b);
+    }
+  for (size_t i = 0; i < count * DIST_ARITY; i++)
+    switch (d->kind)
+      {
+      case DIST_UNIFORM:
+        randoms[i] = d->a + (d->b - d->a) * dist_random01 ();
+        break;
+      case DIST_LOGUNIFORM:
+        randoms[i] = exp2l (la + (lb - la) * dist_random01 ());
+        break;
+      case DIST_ALLBITS:
+        randoms[i] = dist_allbits ();
+        break;
+      default:
+        randoms[i] = random_under_test ();
+      }
+  fprintf (stderr, "inputs: ");
+  dist_print (stderr, d);
+  fprintf (stderr, "\n");
+}
@@ -0,0 +1,389 @@
+/* Hardware counters of the calling thread, with perf_event_open().
+
+Copyright (c) 2025 The CORE-MATH Authors.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* The events of perf_events[] are opened for the calling thread, user
+   space only. The generic events of the kernel have no L2 cache, thus the
+   last level cache (LLC) is counted instead. The retired micro-operations
+   are a raw event, whose code depends on the vendor (Intel or AMD). The
+   top-down level 1 (the fraction of the pipeline slots that retire, are
+   lost to bad speculation, or are stalled in the front-end or in the
+   back-end) uses the events slots and topdown-* which the kernel exports
+   in /sys/bus/event_source/devices/cpu/events on recent Intel processors
+   (Ice Lake and later). The floating-point assists (microcode handling
+   subnormal inputs or outputs, on Intel only) are also a raw event, which
+   depends on the generation. An event that cannot be opened (no such counter,
+   or perf_event_paranoid too high, which can be lowered as explained in
+   README.md) has fd -1, and its count is reported as unavailable; the
+   other events still work. */
+
+#ifndef PERF_EVENTS_H
+#define PERF_EVENTS_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#ifdef __x86_64__
+#include <cpuid.h>
+#endif
+
+#define PERF_CACHE_MISS(cache)                                          \
+  ((cache) | (PERF_COUNT_HW_CACHE_OP_READ << 8)                         \
+   | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16))
+
+/* how the type and config of an event are found */
+enum {
+  PERF_SRC_GENERIC, /* type and config of the table */
+  PERF_SRC_UOPS,    /* raw event, depending on the vendor */
+  PERF_SRC_SYSFS,   /* named event of the cpu PMU in sysfs */
+  PERF_SRC_ASSISTS, /* raw event, depending on the generation */
+};
+
+/* role in the top-down level 1 */
+enum {
+  PERF_TD_NONE,
+  PERF_TD_SLOTS,  /* group leader, not printed */
+  PERF_TD_METRIC, /* printed as a fraction of the sum of the metrics */
+};
+
+static const struct {
+  const char *name;
+  int src;
+  uint32_t type;
+  uint64_t config;
+  int topdown;
+} perf_events[] = {
+  { "cycles", PERF_SRC_GENERIC, PERF_TYPE_HARDWARE,
+    PERF_COUNT_HW_CPU_CYCLES, PERF_TD_NONE },
+  { "instructions", PERF_SRC_GENERIC, PERF_TYPE_HARDWARE,
+    PERF_COUNT_HW_INSTRUCTIONS, PERF_TD_NONE },
+  { "branch-misses", PERF_SRC_GENERIC, PERF_TYPE_HARDWARE,
+    PERF_COUNT_HW_BRANCH_MISSES, PERF_TD_NONE },
+  { "L1I-misses", PERF_SRC_GENERIC, PERF_TYPE_HW_CACHE,
+    PERF_CACHE_MISS (PERF_COUNT_HW_CACHE_L1I), PERF_TD_NONE },
+  { "L1D-misses", PERF_SRC_GENERIC, PERF_TYPE_HW_CACHE,
+    PERF_CACHE_MISS (PERF_COUNT_HW_CACHE_L1D), PERF_TD_NONE },
+  { "LLC-misses", PERF_SRC_GENERIC, PERF_TYPE_HW_CACHE,
+    PERF_CACHE_MISS (PERF_COUNT_HW_CACHE_LL), PERF_TD_NONE },
+  /* the type and config of the following events are found at run time */
+  { "uops", PERF_SRC_UOPS, 0, 0, PERF_TD_NONE },
+  { "fp-assists", PERF_SRC_ASSISTS, 0, 0, PERF_TD_NONE },
+  { "slots", PERF_SRC_SYSFS, 0, 0, PERF_TD_SLOTS },
+  { "topdown-retiring", PERF_SRC_SYSFS, 0, 0, PERF_TD_METRIC },
+  { "topdown-bad-spec", PERF_SRC_SYSFS, 0, 0, PERF_TD_METRIC },
+  { "topdown-fe-bound", PERF_SRC_SYSFS, 0, 0, PERF_TD_METRIC },
+  { "topdown-be-bound", PERF_SRC_SYSFS, 0, 0, PERF_TD_METRIC },
+};
+
+#define PERF_NEVENTS ((int) (sizeof (perf_events) / sizeof (perf_events[0])))
+
+typedef struct {
+  int fd[PERF_NEVENTS];
+  uint64_t count[PERF_NEVENTS];
+} perf_counters_t;
+
+/* Read the first line of the file dir/name into buf, return 0 on error. */
+static int
+perf_read_line (const char *dir, const char *name, char *buf, int size)
+{
+  char path[256];
+  snprintf (path, sizeof (path), "%s/%s", dir, name);
+  FILE *f = fopen (path, "r");
+  if (f == NULL)
+    return 0;
+  int ok = fgets (buf, size, f) != NULL;
+  fclose (f);
+  return ok;
+}
+
+/* Find the named event of the cpu PMU in sysfs: the file events/name
+   holds terms such as "event=0x00,umask=0x80", and the file format/term
+   the bits of config where the value of each term goes (for example
+   "config:8-15"). Return 0 if the event is unknown. */
+static int
+perf_sysfs_event (const char *name, uint32_t *type, uint64_t *config)
+{
+  /* hybrid processors have cpu_core and cpu_atom instead of cpu */
+  static const char *pmus[] = { "/sys/bus/event_source/devices/cpu",
+                                "/sys/bus/event_source/devices/cpu_core" };
+  for (unsigned p = 0; p < sizeof (pmus) / sizeof (pmus[0]); p++)
+    {
+      char buf[256], dir[128];
+      if (!perf_read_line (pmus[p], "type", buf, sizeof (buf)))
+        continue;
+      *type = atoi (buf);
+      snprintf (dir, sizeof (dir), "%s/events", pmus[p]);
+      if (!perf_read_line (dir, name, buf, sizeof (buf)))
+        continue;
+      snprintf (dir, sizeof (dir), "%s/format", pmus[p]);
+      *config = 0;
+      for (char *term = strtok (buf, ",\n"); term != NULL;
+           term = strtok (NULL, ",\n"))
+        {
+          char *eq = strchr (term, '=');
+          uint64_t value = 1;
+          if (eq != NULL)
+            {
+              *eq = '\0';
+              value = strtoull (eq + 1, NULL, 0);
+            }
+          char format[64];
+          int lo, hi;
+          if (!perf_read_line (dir, term, format, sizeof (format)))
+            return 0;
+          int n = sscanf (format, "config:%d-%d", &lo, &hi);
+          if (n < 1)
+            return 0; /* config1 or config2 */
+          if (n == 1)
+            hi = lo;
+          uint64_t mask = (hi - lo == 63) ? ~(uint64_t) 0
+            : (((uint64_t) 1 << (hi - lo + 1)) - 1);
+          *config |= (value & mask) << lo;
+        }
+      return 1;
+    }
+  return 0;
+}
+
+/* Put in vendor the vendor of the processor ("GenuineIntel",
+   "AuthenticAMD", ...), and its family and model (with the extended ones
+   as cpuid defines them), return 0 if unknown. */
+static int
+perf_cpu (char vendor[13], unsigned *family, unsigned *model)
+{
+#ifdef __x86_64__
+  unsigned a, b, c, d;
+  if (!__get_cpuid (0, &a, &b, &c, &d))
+    return 0;
+  memcpy (vendor, &b, 4);
+  memcpy (vendor + 4, &d, 4);
+  memcpy (vendor + 8, &c, 4);
+  vendor[12] = '\0';
+  if (!__get_cpuid (1, &a, &b, &c, &d))
+    return 0;
+  *family = (a >> 8) & 0xf;
+  *model = (a >> 4) & 0xf;
+  if (*family == 6 || *family == 15)
+    *model |= ((a >> 16) & 0xf) << 4;
+  if (*family == 15)
+    *family += (a >> 20) & 0xff;
+  return 1;
+#else
+  (void) vendor;
+  (void) family;
+  (void) model;
+  return 0;
+#endif
+}
+
+/* The retired micro-operations: UOPS_RETIRED.SLOTS (event 0xc2, umask 2)
+   on Intel, and ex_ret_ops (event 0xc1) on AMD. Return 0 elsewhere. */
+static int
+perf_uops_event (uint32_t *type, uint64_t *config)
+{
+  char vendor[13];
+  unsigned family, model;
+  if (!perf_cpu (vendor, &family, &model))
+    return 0;
+  *type = PERF_TYPE_RAW;
+  if (strcmp (vendor, "GenuineIntel") == 0)
+    {
+      *config = 0x02c2;
+      return 1;
+    }
+  if (strcmp (vendor, "AuthenticAMD") == 0)
+    {
+      *config = 0xc1;
+      return 1;
+    }
+  return 0;
+}
+
+/* The floating-point assists on Intel: FP_ASSIST.ANY (event 0xca, umask
+   0x1e) from Haswell to Cascade Lake, and ASSISTS.FP (event 0xc1, umask 2)
+   from Ice Lake on. Return 0 elsewhere (AMD has no such event). */
+static int
+perf_assists_event (uint32_t *type, uint64_t *config)
+{
+  static const unsigned older[] = { 0x3c, 0x3f, 0x45, 0x46, 0x3d, 0x47,
+                                    0x4f, 0x56, 0x4e, 0x5e, 0x55, 0x8e,
+                                    0x9e, 0xa5, 0xa6 };
+  char vendor[13];
+  unsigned family, model;
+  if (!perf_cpu (vendor, &family, &model)
+      || strcmp (vendor, "GenuineIntel") != 0 || family != 6
+      || model < 0x3c)
+    return 0;
+  *type = PERF_TYPE_RAW;
+  *config = 0x02c1;
+  for (unsigned k = 0; k < sizeof (older) / sizeof (older[0]); k++)
+    if (model == older[k])
+      *config = 0x1eca;
+  return 1;
+}
+
+/* Open the event k of perf_events[] in the group of the fd group (or in
+   its own group if group < 0), disabled unless in a group. Return the fd,
+   or -1 if the event is unavailable. */
+static int
+perf_event_fd (int k, int group)
+{
+  uint32_t type = perf_events[k].type;
+  uint64_t config = perf_events[k].config;
+  if ((perf_events[k].src == PERF_SRC_UOPS
+       && !perf_uops_event (&type, &config))
+      || (perf_events[k].src == PERF_SRC_ASSISTS
+          && !perf_assists_event (&type, &config))
+      || (perf_events[k].src == PERF_SRC_SYSFS
+          && !perf_sysfs_event (perf_events[k].name, &type, &config)))
+    return -1;
+  struct perf_event_attr attr;
+  memset (&attr, 0, sizeof (attr));
+  attr.size = sizeof (attr);
+  attr.type = type;
+  attr.config = config;
+  attr.disabled = group < 0;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED
+    | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return syscall (SYS_perf_event_open, &attr, 0, -1, group, 0);
+}
+
+static void
+perf_counters_open (perf_counters_t *c)
+{
+  int slots = -1;
+  for (int k = 0; k < PERF_NEVENTS; k++)
+    {
+      c->count[k] = 0;
+      /* the metrics are only counted in a group led by slots */
+      if (perf_events[k].topdown == PERF_TD_METRIC)
+        c->fd[k] = (slots < 0) ? -1 : perf_event_fd (k, slots);
+      else
+        c->fd[k] = perf_event_fd (k, -1);
+      if (perf_events[k].topdown == PERF_TD_SLOTS)
+        slots = c->fd[k];
+    }
+}
+
+static void
+perf_counters_start (perf_counters_t *c)
+{
+  for (int k = 0; k < PERF_NEVENTS; k++)
+    if (c->fd[k] >= 0)
+      {
+        ioctl (c->fd[k], PERF_EVENT_IOC_RESET, 0);
+        ioctl (c->fd[k], PERF_EVENT_IOC_ENABLE, 0);
+      }
+}
+
+/* Stop the counters and read them into c->count[]. With more events than
+   hardware counters, the kernel multiplexes them, thus each count is
+   scaled by the time it was enabled over the time it was counting. */
+static void
+perf_counters_stop (perf_counters_t *c)
+{
+  for (int k = 0; k < PERF_NEVENTS; k++)
+    if (c->fd[k] >= 0)
+      ioctl (c->fd[k], PERF_EVENT_IOC_DISABLE, 0);
+  for (int k = 0; k < PERF_NEVENTS; k++)
+    {
+      uint64_t v[3]; /* value, time enabled, time running */
+      c->count[k] = 0;
+      if (c->fd[k] >= 0 && read (c->fd[k], v, sizeof (v)) == sizeof (v)
+          && v[2] > 0)
+        c->count[k] = (v[2] < v[1]) ? (double) v[0] * v[1] / v[2] : v[0];
+    }
+}
+
+static void
+perf_counters_close (perf_counters_t *c)
+{
+  for (int k = 0; k < PERF_NEVENTS; k++)
+    if (c->fd[k] >= 0)
+      close (c->fd[k]);
+}
+
+static int
+perf_event_index (const char *name)
+{
+  for (int k = 0; k < PERF_NEVENTS; k++)
+    if (strcmp (perf_events[k].name, name) == 0)
+      return k;
+  return -1;
+}
+
+/* Print the counts per call (for calls calls), then the instructions per
+   cycle, and the top-down level 1 in percent of the slots, one per line
+   with the name first: n/a when unavailable. */
+static void
+perf_counters_print (const perf_counters_t *c, double calls)
+{
+  for (int k = 0; k < PERF_NEVENTS; k++)
+    {
+      if (perf_events[k].topdown != PERF_TD_NONE)
+        continue;
+      if (c->fd[k] >= 0)
+        printf ("  %-16s %10.3f per call\n", perf_events[k].name,
+                c->count[k] / calls);
+      else
+        printf ("  %-16s %10s\n", perf_events[k].name, "n/a");
+    }
+
+  int cyc = perf_event_index ("cycles");
+  int ins = perf_event_index ("instructions");
+  if (c->fd[cyc] >= 0 && c->fd[ins] >= 0 && c->count[cyc] > 0)
+    printf ("  %-16s %10.3f\n", "IPC",
+            (double) c->count[ins] / c->count[cyc]);
+  else
+    printf ("  %-16s %10s\n", "IPC", "n/a");
+
+  uint64_t slots = 0;
+  int all = 1;
+  for (int k = 0; k < PERF_NEVENTS; k++)
+    if (perf_events[k].topdown == PERF_TD_METRIC)
+      {
+        slots += c->count[k];
+        all = all && c->fd[k] >= 0;
+      }
+  for (int k = 0; k < PERF_NEVENTS; k++)
+    if (perf_events[k].topdown == PERF_TD_METRIC)
+      {
+        const char *name = perf_events[k].name + strlen ("topdown-");
+        if (all && slots > 0)
+          printf ("  %-16s %9.1f%% of slots\n", name,
+                  100.0 * c->count[k] / slots);
+        else
+          printf ("  %-16s %10s\n", name, "n/a");
+      }
+}
+
+#endif
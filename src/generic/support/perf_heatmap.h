@@ -0,0 +1,294 @@
+/* Cost of a function over its input domain (perf --heatmap).
+
+Copyright (c) 2025 The CORE-MATH Authors.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* With --heatmap path.csv, the perf program does not read --file: it
+   splits the domain of each argument into classes, evaluates the function
+   on --cell-count random inputs of each cell (one class per argument), and
+   writes for each cell the cycles/call (minimum over the --repeat passes)
+   in path.csv, and, with CORE_MATH_STATS (see stats.h), the fraction of
+   the calls which left the fast path (accurate path, database of hard
+   cases, special cases). It also prints the cycles/call of the cells as a
+   heatmap on stdout.
+
+   The classes of an argument are, for each sign, the binades of the normal
+   numbers (grouped by --cells per sign, 64 by default for a univariate
+   function and 24 for a bivariate one, or restricted with --binades a,b to
+   the numbers in [2^a,2^b)), then the subnormals, zero, infinity and NaN.
+   A univariate function has one row per sign, and one column per class of
+   positive numbers. A bivariate function has one row per class of y and
+   one column per class of x, for positive arguments, or for both signs
+   with --signs. */
+
+enum { HM_BINADE, HM_SUBNORMAL, HM_ZERO, HM_INF, HM_NAN };
+
+static const char hm_kind_name[][10] = { "binade", "subnormal", "zero",
+                                         "inf", "nan" };
+/* the symbols of the columns of the special classes in the heatmap */
+static const char hm_kind_symbol[] = "bszin";
+
+typedef struct {
+  int neg, kind;
+  int e0, e1; /* for HM_BINADE, the numbers in [2^e0,2^e1) */
+} hm_class_t;
+
+typedef struct {
+  int cells, signs, cell_count, repeat;
+  int e0, e1; /* binades of --binades */
+} hm_options_t;
+
+/* exponent of the smallest normal number, of the largest binade plus one,
+   and number of bits of the significand after the point */
+#define HM_EMIN                                                         \
+  ((sizeof (TYPE_UNDER_TEST) == sizeof (float)) ? FLT_MIN_EXP - 1       \
+   : (sizeof (TYPE_UNDER_TEST) == sizeof (double)) ? DBL_MIN_EXP - 1    \
+   : LDBL_MIN_EXP - 1)
+#define HM_EMAX                                                         \
+  ((sizeof (TYPE_UNDER_TEST) == sizeof (float)) ? FLT_MAX_EXP           \
+   : (sizeof (TYPE_UNDER_TEST) == sizeof (double)) ? DBL_MAX_EXP        \
+   : LDBL_MAX_EXP)
+#define HM_PREC                                                         \
+  ((sizeof (TYPE_UNDER_TEST) == sizeof (float)) ? FLT_MANT_DIG - 1      \
+   : (sizeof (TYPE_UNDER_TEST) == sizeof (double)) ? DBL_MANT_DIG - 1   \
+   : LDBL_MANT_DIG - 1)
+
+/* Put in c the classes of the numbers of sign neg (or of both signs if
+   neg < 0), and return their number. */
+static int
+hm_classes (hm_class_t *c, int neg, const hm_options_t *o)
+{
+  int n = 0;
+  for (int s = 0; s < 2; s++)
+    {
+      if (neg >= 0 && s != neg)
+        continue;
+      int range = o->e1 - o->e0, cells = o->cells;
+      if (cells > range)
+        cells = range;
+      for (int k = 0; k < cells; k++)
+        c[n++] = (hm_class_t) { s, HM_BINADE,
+                                o->e0 + (int) ((long) range * k / cells),
+                                o->e0 + (int) ((long) range * (k + 1) / cells) };
+      for (int kind = HM_SUBNORMAL; kind <= HM_NAN; kind++)
+        c[n++] = (hm_class_t) { s, kind, 0, 0 };
+    }
+  return n;
+}
+
+/* random number of class c */
+static TYPE_UNDER_TEST
+hm_sample (const hm_class_t *c)
+{
+  long double m = floorl (dist_random01 () * ldexpl (1.0L, HM_PREC));
+  long double x;
+  switch (c->kind)
+    {
+    case HM_BINADE:
+      /* exact, thus below the next binade */
+      x = ldexpl (1.0L + ldexpl (m, -HM_PREC),
+                  c->e0 + rand () % (c->e1 - c->e0));
+      break;
+    case HM_SUBNORMAL:
+      x = ldexpl (m + (m == 0), HM_EMIN - HM_PREC);
+      break;
+    case HM_ZERO:
+      x = 0;
+      break;
+    case HM_INF:
+      x = INFINITY;
+      break;
+    default:
+      x = NAN;
+    }
+  return c->neg ? -(TYPE_UNDER_TEST) x : (TYPE_UNDER_TEST) x;
+}
+
+static void
+hm_csv_class (FILE *f, const hm_class_t *c)
+{
+  fprintf (f, "%c,%s,", c->neg ? '-' : '+', hm_kind_name[c->kind]);
+  if (c->kind == HM_BINADE)
+    fprintf (f, "%d,%d,", c->e0, c->e1);
+  else
+    fprintf (f, ",,");
+}
+
+/* the cycles/call and the fraction of slow calls of the cell (cx,cy), or
+   -1 without CORE_MATH_STATS (some functions are compiled with
+   -ffinite-math-only, thus NaN is not used as a marker) */
+static void
+hm_cell (double *cycles, double *slow, const hm_class_t *cx,
+         const hm_class_t *cy, TYPE_UNDER_TEST *randoms,
+         const hm_options_t *o,
+         function_type_under_test *p_function_under_test)
+{
+  int count = o->cell_count;
+  for (int i = 0; i < count; i++)
+    {
+      randoms[i * DIST_ARITY] = hm_sample (cx);
+      if (DIST_ARITY == 2)
+        randoms[i * DIST_ARITY + 1] = hm_sample (cy);
+    }
+  *cycles = DBL_MAX;
+  for (int r = 0; r < o->repeat; r++)
+    {
+      uint64_t start = __rdtsc ();
+      for (int i = 0; i < count; i++)
+        {
+          CALL_THROUGHPUT(i);
+        }
+      double c = (double) (__rdtsc () - start) / count;
+      if (c < *cycles)
+        *cycles = c;
+    }
+  *slow = -1;
+#ifdef CORE_MATH_STATS
+  int n = 0;
+  for (int i = 0; i < count; i++)
+    {
+      __cr_stats_last = -1;
+      CALL_THROUGHPUT(i);
+      n += __cr_stats_last >= 0;
+    }
+  *slow = (double) n / count;
+#endif
+}
+
+/* heatmap character of c cycles/call, on a log scale from lo to hi */
+static const char hm_shades[] = " .:-=+*#%@";
+#define HM_NSHADES ((int) sizeof (hm_shades) - 1)
+
+static int
+hm_shade (double c, double lo, double hi)
+{
+  if (!(hi > lo))
+    return 0;
+  int k = (int) (HM_NSHADES * log (c / lo) / log (hi / lo));
+  return (k < 0) ? 0 : (k >= HM_NSHADES) ? HM_NSHADES - 1 : k;
+}
+
+/* label of the class c of a row, or of a tick under the columns */
+static void
+hm_label (char *s, size_t size, const hm_class_t *c)
+{
+  if (c->kind == HM_BINADE)
+    snprintf (s, size, "%s2^%d", c->neg ? "-" : "", c->e0);
+  else
+    snprintf (s, size, "%s%s", c->neg ? "-" : "", hm_kind_name[c->kind]);
+}
+
+static void
+heatmap (const char *path, const hm_options_t *o,
+         function_type_under_test *p_function_under_test)
+{
+  int bivariate = DIST_ARITY == 2;
+  int max = 2 * (o->cells + 4);
+  hm_class_t *cx = malloc (max * sizeof (hm_class_t));
+  hm_class_t *cy = malloc (max * sizeof (hm_class_t));
+  TYPE_UNDER_TEST *randoms = malloc (o->cell_count * SAMPLE_SIZE);
+  if (cx == NULL || cy == NULL || randoms == NULL)
+    {
+      perror ("malloc");
+      exit (3);
+    }
+  int signs = o->signs ? -1 : 0;
+  int nx = hm_classes (cx, bivariate ? signs : 0, o), ny;
+  if (bivariate)
+    ny = hm_classes (cy, signs, o);
+  else
+    {
+      /* one row per sign: the columns are the positive classes */
+      ny = 2;
+      cy[0] = (hm_class_t) { 0, HM_ZERO, 0, 0 };
+      cy[1] = (hm_class_t) { 1, HM_ZERO, 0, 0 };
+    }
+  FILE *f = fopen (path, "w");
+  if (f == NULL)
+    {
+      perror (path);
+      exit (3);
+    }
+  fprintf (f, "x_sign,x_class,x_emin,x_emax,%scycles,slow_path\n",
+           bivariate ? "y_sign,y_class,y_emin,y_emax," : "");
+  double *cycles = malloc ((size_t) nx * ny * sizeof (double));
+  double lo = DBL_MAX, hi = 0;
+  for (int j = 0; j < ny; j++)
+    for (int i = 0; i < nx; i++)
+      {
+        hm_class_t x = cx[i];
+        if (!bivariate)
+          x.neg = cy[j].neg;
+        double slow;
+        hm_cell (&cycles[j * nx + i], &slow, &x, &cy[j], randoms, o,
+                 p_function_under_test);
+        hm_csv_class (f, &x);
+        if (bivariate)
+          hm_csv_class (f, &cy[j]);
+        if (slow < 0)
+          fprintf (f, "%.3f,\n", cycles[j * nx + i]);
+        else
+          fprintf (f, "%.3f,%.6f\n", cycles[j * nx + i], slow);
+        lo = fmin (lo, cycles[j * nx + i]);
+        hi = fmax (hi, cycles[j * nx + i]);
+      }
+  fclose (f);
+
+  /* the map, with the first class of each row on the left, and a tick
+     under every 8th column */
+  char s[32];
+  for (int j = 0; j < ny; j++)
+    {
+      if (bivariate)
+        hm_label (s, sizeof (s), &cy[j]);
+      else
+        snprintf (s, sizeof (s), "%s", cy[j].neg ? "x < 0" : "x > 0");
+      printf ("%10s |", s);
+      for (int i = 0; i < nx; i++)
+        putchar (hm_shades[hm_shade (cycles[j * nx + i], lo, hi)]);
+      printf ("|\n");
+    }
+  printf ("%10s  ", "");
+  for (int i = 0; i < nx; i++)
+    putchar (cx[i].kind != HM_BINADE ? hm_kind_symbol[cx[i].kind]
+             : (i % 8 == 0) ? '^' : ' ');
+  printf ("\n");
+  for (int i = 0; i < nx; i += 8)
+    if (cx[i].kind == HM_BINADE)
+      {
+        hm_label (s, sizeof (s), &cx[i]);
+        printf ("%10s  column %d: %s\n", "", i, s);
+      }
+  printf ("%10s  s = subnormal, z = zero, i = inf, n = nan%s\n", "",
+          bivariate ? " (x on the columns, y on the rows)" : "");
+  printf ("%10s  scale (cycles/call, log):", "");
+  for (int k = 0; k < HM_NSHADES; k++)
+    printf (" '%c' %.0f", hm_shades[k],
+            lo * pow (hi / lo, (double) k / HM_NSHADES));
+  printf ("\n");
+  free (cycles);
+  free (randoms);
+  free (cx);
+  free (cy);
+}
@@ -0,0 +1,499 @@
+/* Performance of a mixed workload of mathematical functions.
+
+Copyright (c) 2025 The CORE-MATH Authors.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* The perf programs call one function in a tight loop, where its tables
+   and code stay in the L1 caches. perf-mix (built by perf-mix.sh, which
+   links all the binary32 and binary64 functions) replays instead a
+   sequence of calls to several functions, drawn from a mix:
+   - --mix exp:40,log:30,sin:10,cos:10,pow:10 gives the weight of each
+     function (the names are those of core-math without cr_, for example
+     expf for the binary32 exponential);
+   - --mix-file path reads the mix from path, with one function per line,
+     optionally followed by its weight (1 by default), and lines starting
+     with # ignored: thus a trace with the name of the function of each
+     call gives the mix of the trace.
+   The calls are interleaved with --order random (the default: each call is
+   drawn independently with the weights), --order rr (a smooth weighted
+   round robin, i.e., the most regular order with the weights), or
+   --order trace (the lines of --mix-file in order, weights giving
+   repetitions). The sequence has --count calls, each with inputs sampled
+   by random_under_test() of its function, and is evaluated --repeat
+   times, for core-math, then for the libm (unless one of the functions
+   is missing in the libm).
+
+   With --trace path (possibly repeated), the sequence is instead the
+   calls recorded in path by libcoremath_trace.so (see trace_preload.c),
+   with their arguments, in order, and the files one after the other; it
+   has all the recorded calls, or --count ones (the trace being repeated
+   if needed).
+
+   For each implementation, the first run gives the cycles per call and
+   the hardware counters of perf_events.h per call; the second run times
+   each call with rdtsc, minus the cost of rdtsc, to attribute the cycles
+   to the functions (this adds some noise, and prevents the overlap of
+   consecutive calls, thus the sum is larger than the first run). */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <fenv.h>
+#ifdef __x86_64__
+#include <x86intrin.h>
+#else
+#include <time.h>
+/* elsewhere, the "cycles" are nanoseconds */
+static inline uint64_t
+__rdtsc (void)
+{
+  struct timespec t;
+  clock_gettime (CLOCK_MONOTONIC, &t);
+  return (uint64_t) t.tv_sec * 1000000000 + t.tv_nsec;
+}
+#endif
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "perf_mix.h"
+#include "perf_events.h"
+#include "perf_trace.h"
+
+_Static_assert (TRACE_ARGS_SIZE == MIX_INPUT_SIZE,
+                "the records of a trace are not inputs of perf-mix");
+
+#define MIX_MAX 128 /* functions in a mix */
+
+extern mix_get_entry_t *const __start_mix_entries[], *const __stop_mix_entries[];
+
+typedef struct {
+  const mix_entry_t *e;
+  double weight;
+} mix_t;
+
+static mix_t mix[MIX_MAX];
+static int nmix = 0;
+
+/* the trace of --order trace or --trace: indices in mix[], and for --trace
+   the inputs of each call */
+static int *trace = NULL;
+static unsigned char *trace_inputs = NULL;
+static int ntrace = 0, trace_size = 0;
+
+static void
+trace_push (int k, const unsigned char *x)
+{
+  if (ntrace == trace_size)
+    {
+      trace_size = (trace_size == 0) ? 1024 : 2 * trace_size;
+      trace = realloc (trace, trace_size * sizeof (int));
+      if (x != NULL)
+        trace_inputs = realloc (trace_inputs,
+                                (size_t) trace_size * MIX_INPUT_SIZE);
+      if (trace == NULL || (x != NULL && trace_inputs == NULL))
+        {
+          perror ("realloc");
+          exit (3);
+        }
+    }
+  if (x != NULL)
+    memcpy (trace_inputs + (size_t) ntrace * MIX_INPUT_SIZE, x,
+            MIX_INPUT_SIZE);
+  trace[ntrace++] = k;
+}
+
+static const mix_entry_t *
+mix_find (const char *name)
+{
+  for (mix_get_entry_t *const *p = __start_mix_entries;
+       p < __stop_mix_entries; p++)
+    {
+      const mix_entry_t *e = (*p) ();
+      if (strcmp (e->name, name) == 0)
+        return e;
+    }
+  fprintf (stderr, "Error, unknown function %s, the functions are:", name);
+  for (mix_get_entry_t *const *p = __start_mix_entries;
+       p < __stop_mix_entries; p++)
+    fprintf (stderr, " %s", (*p) ()->name);
+  fprintf (stderr, "\n");
+  exit (1);
+}
+
+/* add weight to name, and return its index in mix[] */
+static int
+mix_add (const char *name, double weight)
+{
+  if (!(weight > 0))
+    {
+      fprintf (stderr, "Error, invalid weight for %s\n", name);
+      exit (1);
+    }
+  const mix_entry_t *e = mix_find (name);
+  for (int k = 0; k < nmix; k++)
+    if (mix[k].e == e)
+      {
+        mix[k].weight += weight;
+        return k;
+      }
+  if (nmix == MIX_MAX)
+    {
+      fprintf (stderr, "Error, more than %d functions\n", MIX_MAX);
+      exit (1);
+    }
+  mix[nmix].e = e;
+  mix[nmix].weight = weight;
+  return nmix++;
+}
+
+/* parse "name:weight,name:weight,..." */
+static void
+mix_parse (char *spec)
+{
+  for (char *s = strtok (spec, ","); s != NULL; s = strtok (NULL, ","))
+    {
+      char *colon = strchr (s, ':');
+      double weight = 1;
+      if (colon != NULL)
+        {
+          *colon = '\0';
+          weight = atof (colon + 1);
+        }
+      mix_add (s, weight);
+    }
+}
+
+static void
+mix_read (const char *path)
+{
+  FILE *fp = fopen (path, "r");
+  if (fp == NULL)
+    {
+      perror (path);
+      exit (3);
+    }
+  char buf[1024], name[256];
+  while (fgets (buf, sizeof (buf), fp) != NULL)
+    {
+      double weight = 1;
+      if (buf[0] == '#' || sscanf (buf, "%255s %lf", name, &weight) < 1)
+        continue;
+      int k = mix_add (name, weight);
+      for (int j = 0; j < (int) weight; j++)
+        trace_push (k, NULL);
+    }
+  fclose (fp);
+}
+
+/* append the calls recorded in the trace file path (see perf_trace.h) */
+static void
+trace_read (const char *path)
+{
+  int fd = open (path, O_RDONLY);
+  struct stat st;
+  if (fd < 0 || fstat (fd, &st) < 0)
+    {
+      perror (path);
+      exit (3);
+    }
+  const trace_header_t *h = MAP_FAILED;
+  if ((size_t) st.st_size >= sizeof (trace_header_t))
+    h = mmap (NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close (fd);
+  if (h == MAP_FAILED || memcmp (h->magic, TRACE_MAGIC, sizeof (h->magic))
+      || h->nfunctions > TRACE_MAX_FUNCTIONS
+      || (st.st_size - sizeof (trace_header_t)) / sizeof (trace_record_t)
+         < h->capacity)
+    {
+      fprintf (stderr, "Error, %s is not a trace file\n", path);
+      exit (1);
+    }
+  const trace_record_t *ring = (const trace_record_t *) (h + 1);
+  uint64_t n = (h->next < h->capacity) ? h->next : h->capacity;
+  uint64_t first = h->next - n;
+  int index[TRACE_MAX_FUNCTIONS]; /* in mix[], -1 if not added yet */
+  for (int k = 0; k < TRACE_MAX_FUNCTIONS; k++)
+    index[k] = -1;
+  for (uint64_t i = first; i < h->next; i++)
+    {
+      const trace_record_t *r = &ring[i % h->capacity];
+      if (r->function >= h->nfunctions)
+        {
+          fprintf (stderr, "Error, invalid record in %s\n", path);
+          exit (1);
+        }
+      int k = index[r->function];
+      if (k < 0)
+        {
+          char name[TRACE_NAME_SIZE + 1] = {0};
+          memcpy (name, h->names[r->function], TRACE_NAME_SIZE);
+          k = index[r->function] = mix_add (name, 1);
+        }
+      else
+        mix[k].weight += 1;
+      trace_push (k, r->args);
+    }
+  fprintf (stderr, "trace %s: %llu records of %llu calls (1 in %u)%s\n",
+           path, (unsigned long long) n, (unsigned long long) h->calls,
+           h->rate, (h->next > n) ? ", the oldest ones overwritten" : "");
+  munmap ((void *) h, st.st_size);
+}
+
+enum { ORDER_RANDOM, ORDER_RR, ORDER_TRACE };
+
+/* the index in mix[] of each of the count calls */
+static void
+mix_sequence (int *seq, int count, int order)
+{
+  double total = 0, current[MIX_MAX] = {0};
+  for (int k = 0; k < nmix; k++)
+    total += mix[k].weight;
+  for (int i = 0; i < count; i++)
+    {
+      int k = 0;
+      if (order == ORDER_TRACE)
+        k = trace[i % ntrace];
+      else if (order == ORDER_RANDOM)
+        {
+          double u = total * ((double) rand () / ((double) RAND_MAX + 1));
+          while (k < nmix - 1 && u >= mix[k].weight)
+            u -= mix[k++].weight;
+        }
+      else
+        {
+          /* smooth weighted round robin */
+          for (int j = 0; j < nmix; j++)
+            {
+              current[j] += mix[j].weight;
+              if (current[j] > current[k])
+                k = j;
+            }
+          current[k] -= total;
+        }
+      seq[i] = k;
+    }
+}
+
+static void
+run (const char *label, int libm, const int *seq, const unsigned char *inputs,
+     int count, int repeat)
+{
+  /* the calls of the sequence, resolved once */
+  void (**call) (const void *) = malloc (count * sizeof (*call));
+  if (call == NULL)
+    {
+      perror ("malloc");
+      exit (3);
+    }
+  for (int i = 0; i < count; i++)
+    call[i] = libm ? mix[seq[i]].e->call_libm : mix[seq[i]].e->call_cr;
+
+  perf_counters_t c;
+  perf_counters_open (&c);
+  perf_counters_start (&c);
+  uint64_t start = __rdtsc ();
+  for (int r = 0; r < repeat; r++)
+    for (int i = 0; i < count; i++)
+      call[i] (inputs + i * MIX_INPUT_SIZE);
+  uint64_t stop = __rdtsc ();
+  perf_counters_stop (&c);
+  perf_counters_close (&c);
+  double calls = (double) repeat * count;
+  printf ("%s: %.3f cycles/call (rdtsc)\n", label, (stop - start) / calls);
+  perf_counters_print (&c, calls);
+
+  uint64_t overhead = UINT64_MAX;
+  for (int i = 0; i < 1000; i++)
+    {
+      uint64_t t0 = __rdtsc ();
+      uint64_t t1 = __rdtsc ();
+      if (t1 - t0 < overhead)
+        overhead = t1 - t0;
+    }
+  uint64_t cycles[MIX_MAX] = {0}, ncalls[MIX_MAX] = {0}, sum = 0;
+  for (int r = 0; r < repeat; r++)
+    for (int i = 0; i < count; i++)
+      {
+        uint64_t t0 = __rdtsc ();
+        call[i] (inputs + i * MIX_INPUT_SIZE);
+        uint64_t t1 = __rdtsc ();
+        uint64_t d = (t1 - t0 > overhead) ? t1 - t0 - overhead : 0;
+        cycles[seq[i]] += d;
+        ncalls[seq[i]]++;
+        sum += d;
+      }
+  printf ("  %-14s %10s %10s %12s\n", "function", "calls", "cycles/call",
+          "cycles");
+  for (int k = 0; k < nmix; k++)
+    printf ("  %-14s %9.3f%% %11.3f %11.3f%%\n", mix[k].e->name,
+            100.0 * ncalls[k] / calls,
+            ncalls[k] ? (double) cycles[k] / ncalls[k] : 0.0,
+            sum ? 100.0 * cycles[k] / sum : 0.0);
+  free (call);
+}
+
+int
+main (int argc, char *argv[])
+{
+  int count = 0, repeat = 100, order = ORDER_RANDOM;
+
+  while (argc >= 2)
+    {
+      if (strcmp (argv[1], "--mix") == 0 && argc >= 3)
+        {
+          mix_parse (argv[2]);
+          argc -= 2;
+          argv += 2;
+        }
+      else if (strcmp (argv[1], "--mix-file") == 0 && argc >= 3)
+        {
+          if (trace_inputs != NULL)
+            {
+              fprintf (stderr, "Error, --trace and --mix-file are "
+                       "exclusive\n");
+              exit (1);
+            }
+          mix_read (argv[2]);
+          argc -= 2;
+          argv += 2;
+        }
+      else if (strcmp (argv[1], "--trace") == 0 && argc >= 3)
+        {
+          if (ntrace > 0 && trace_inputs == NULL)
+            {
+              fprintf (stderr, "Error, --trace and --mix-file are "
+                       "exclusive\n");
+              exit (1);
+            }
+          trace_read (argv[2]);
+          order = ORDER_TRACE;
+          argc -= 2;
+          argv += 2;
+        }
+      else if (strcmp (argv[1], "--order") == 0 && argc >= 3)
+        {
+          if (strcmp (argv[2], "random") == 0)
+            order = ORDER_RANDOM;
+          else if (strcmp (argv[2], "rr") == 0)
+            order = ORDER_RR;
+          else if (strcmp (argv[2], "trace") == 0)
+            order = ORDER_TRACE;
+          else
+            {
+              fprintf (stderr, "Error, unknown order %s\n", argv[2]);
+              exit (1);
+            }
+          argc -= 2;
+          argv += 2;
+        }
+      else if (strcmp (argv[1], "--count") == 0 && argc >= 3)
+        {
+          count = atoi (argv[2]);
+          argc -= 2;
+          argv += 2;
+        }
+      else if (strcmp (argv[1], "--repeat") == 0 && argc >= 3)
+        {
+          repeat = atoi (argv[2]);
+          argc -= 2;
+          argv += 2;
+        }
+      else
+        {
+          fprintf (stderr, "Error, unknown option %s\n", argv[1]);
+          exit (1);
+        }
+    }
+
+  if (nmix == 0)
+    {
+      fprintf (stderr, "--mix, --mix-file or --trace is mandatory\n");
+      exit (2);
+    }
+  if (trace_inputs != NULL && order != ORDER_TRACE)
+    {
+      fprintf (stderr, "Error, --trace replays the calls in order\n");
+      exit (1);
+    }
+  if (count == 0)
+    count = (trace_inputs != NULL) ? ntrace : 100000;
+  if (order == ORDER_TRACE && ntrace == 0)
+    {
+      fprintf (stderr, "Error, --order trace needs --mix-file\n");
+      exit (1);
+    }
+  if (count <= 0 || repeat <= 0)
+    {
+      fprintf (stderr, "Error, invalid --count or --repeat\n");
+      exit (1);
+    }
+
+  int *seq = malloc (count * sizeof (int));
+  unsigned char *inputs = malloc ((size_t) count * MIX_INPUT_SIZE);
+  if (seq == NULL || inputs == NULL)
+    {
+      perror ("malloc");
+      exit (3);
+    }
+  mix_sequence (seq, count, order);
+  for (int i = 0; i < count; i++)
+    if (trace_inputs != NULL)
+      memcpy (inputs + (size_t) i * MIX_INPUT_SIZE,
+              trace_inputs + (size_t) (i % ntrace) * MIX_INPUT_SIZE,
+              MIX_INPUT_SIZE);
+    else
+      mix[seq[i]].e->random (inputs + i * MIX_INPUT_SIZE);
+
+  double total = 0;
+  for (int k = 0; k < nmix; k++)
+    total += mix[k].weight;
+  printf ("mix:");
+  for (int k = 0; k < nmix; k++)
+    printf (" %s %.1f%%", mix[k].e->name, 100.0 * mix[k].weight / total);
+  printf (" (order %s, %d calls, repeat %d)\n",
+          (order == ORDER_RANDOM) ? "random"
+          : (order == ORDER_RR) ? "rr" : "trace", count, repeat);
+
+  fesetround (FE_TONEAREST);
+  run ("core-math", 0, seq, inputs, count, repeat);
+  int libm = 1;
+  for (int k = 0; k < nmix; k++)
+    if (mix[k].e->call_libm == NULL)
+      {
+        fprintf (stderr, "%s is not in the libm; skipping the libm\n",
+                 mix[k].e->name);
+        libm = 0;
+      }
+  if (libm)
+    run ("libm", 1, seq, inputs, count, repeat);
+
+  free (seq);
+  free (inputs);
+  return 0;
+}
@@ -0,0 +1,51 @@
+/* Functions of the mixed workload benchmark (see perf_mix.c).
+
+Copyright (c) 2025 The CORE-MATH Authors.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef PERF_MIX_H
+#define PERF_MIX_H
+
+/* the arguments of one call, for any function */
+#define MIX_INPUT_SIZE 16
+
+/* Each function linked into perf-mix is described by an entry, defined by
+   perf_mix_entry.c compiled for this function. A pointer to the function
+   returning this entry is stored in the section mix_entries, so that
+   perf_mix.c finds all the entries between __start_mix_entries and
+   __stop_mix_entries (provided by the GNU linker), without a list of the
+   functions. */
+typedef struct {
+  const char *name;                  /* for example "exp" or "powf" */
+  void (*random) (void *x);          /* sample x with random_under_test() */
+  void (*call_cr) (const void *x);   /* evaluate cr_name on x */
+  void (*call_libm) (const void *x); /* the same with the libm, or NULL if
+                                        the libm does not provide it */
+} mix_entry_t;
+
+typedef const mix_entry_t *mix_get_entry_t (void);
+
+#define MIX_ENTRY_SECTION __attribute__((used, section ("mix_entries")))
+
+#endif
@@ -0,0 +1,113 @@
+/* Entry of one function in the mixed workload benchmark.
+
+Copyright (c) 2025 The CORE-MATH Authors.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* This file is compiled once per function (see perf-mix.sh), with the same
+   defines as the perf programs (TYPE_UNDER_TEST, cr_function_under_test,
+   function_under_test, and -I to the directory of random_under_test.h),
+   and MIX_KIND set to 1 for a univariate function, 2 for a bivariate one,
+   or 3 for a sincos-like one (one input, two outputs). The function of the
+   libm is declared weak: if the libm does not provide it, the entry has no
+   libm call. */
+
+#define _GNU_SOURCE /* for sincos */
+#include <stdlib.h>
+
+#include "random_under_test.h"
+#include "perf_mix.h"
+
+#define MIX_STR(x) MIX_STR1(x)
+#define MIX_STR1(x) #x
+#define MIX_CAT(x,y) MIX_CAT1(x,y)
+#define MIX_CAT1(x,y) x ## y
+
+#if MIX_KIND == 1
+typedef TYPE_UNDER_TEST function_type_under_test (TYPE_UNDER_TEST);
+#define MIX_ARITY 1
+#define MIX_CALL(f,a) f (a[0])
+#elif MIX_KIND == 2
+typedef TYPE_UNDER_TEST function_type_under_test (TYPE_UNDER_TEST,
+                                                  TYPE_UNDER_TEST);
+#define MIX_ARITY 2
+#define MIX_CALL(f,a) f (a[0], a[1])
+#else
+typedef void function_type_under_test (TYPE_UNDER_TEST, TYPE_UNDER_TEST*,
+                                       TYPE_UNDER_TEST*);
+#define MIX_ARITY 1
+#define MIX_CALL(f,a) do {                      \
+    TYPE_UNDER_TEST s, c;                       \
+    f (a[0], &s, &c);                           \
+  } while (0)
+#endif
+
+_Static_assert (MIX_ARITY * sizeof (TYPE_UNDER_TEST) <= MIX_INPUT_SIZE,
+                "MIX_INPUT_SIZE is too small");
+
+function_type_under_test cr_function_under_test;
+function_type_under_test function_under_test __attribute__((weak));
+
+static void
+mix_random (void *x)
+{
+  TYPE_UNDER_TEST *a = x;
+  for (int k = 0; k < MIX_ARITY; k++)
+    a[k] = random_under_test ();
+}
+
+static void
+mix_call_cr (const void *x)
+{
+  const TYPE_UNDER_TEST *a = x;
+  MIX_CALL (cr_function_under_test, a);
+}
+
+static void
+mix_call_libm (const void *x)
+{
+  const TYPE_UNDER_TEST *a = x;
+  MIX_CALL (function_under_test, a);
+}
+
+static const mix_entry_t mix_entry = {
+  .name = MIX_STR (function_under_test),
+  .random = mix_random,
+  .call_cr = mix_call_cr,
+  .call_libm = mix_call_libm,
+};
+
+/* the address of function_under_test is only known at run time */
+static const mix_entry_t *
+mix_get_entry (void)
+{
+  static mix_entry_t e;
+  e = mix_entry;
+  if (function_under_test == NULL)
+    e.call_libm = NULL;
+  return &e;
+}
+
+MIX_ENTRY_SECTION
+static mix_get_entry_t *const MIX_CAT (mix_entry_, function_under_test) =
+  mix_get_entry;
@@ -24,7 +24,7 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
-#define _XOPEN_SOURCE 500   /* for ftruncate */
+#define _GNU_SOURCE   /* for ftruncate, and sched_setaffinity with --threads */
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -59,4 +59,14 @@ function_type_under_test function_under_test;
   p_function_under_test(randoms[i], &x, &y); \
   } while (0)
 
+#ifdef CORE_MATH_PROFILE
+/* an empty function, to calibrate the phase profile (see profile_breakdown
+   in perf_common.h) */
+static void __attribute__((noinline))
+profile_noop (TYPE_UNDER_TEST x, TYPE_UNDER_TEST *s, TYPE_UNDER_TEST *c)
+{
+  *s = *c = x;
+}
+#endif
+
 #include "perf_common.h"
@@ -0,0 +1,230 @@
+/* Cost of a function on special and subnormal inputs (perf --special).
+
+Copyright (c) 2025 The CORE-MATH Authors.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* With --special, the perf program does not read --file: it times the
+   function in throughput on --count inputs of each of the classes below
+   (minimum over the --repeat passes), and prints the cycles/call, the
+   ratio to the normal inputs, and the floating-point assists per call
+   (microcode handling subnormal operands or results, see perf_events.h;
+   n/a if the counter is unavailable):
+   - normal: the inputs of random_under_test(), or of --dist;
+   - nan, +inf, -inf, +0, -0: this value;
+   - +subnormal, -subnormal: random subnormal numbers;
+   - subnormal result: inputs whose result is subnormal (the first one for
+     a sincos-like function), found by sampling the normal inputs, all the
+     binades and the subnormals (n/a if none is found within SP_SEARCH
+     calls).
+   For a bivariate function, each special class is taken by x with y from
+   the normal inputs, then by y with x from the normal inputs.
+   Before the first class, the function runs on the normal inputs for
+   SP_WARMUP ticks of the time-stamp counter: otherwise the normal row is
+   timed while the processor still runs at a lower frequency than the
+   constant rate of the counter (and with cold caches and predictors), and
+   is several times the cycles/call given by --rdtsc. */
+
+#define SP_SEARCH 10000000
+
+#define SP_WARMUP 200000000ull
+
+/* the classes of special inputs, as classes of the heatmap */
+static const struct {
+  const char *name;
+  hm_class_t c;
+} sp_classes[] = {
+  { "nan", { 0, HM_NAN, 0, 0 } },
+  { "+inf", { 0, HM_INF, 0, 0 } },
+  { "-inf", { 1, HM_INF, 0, 0 } },
+  { "+0", { 0, HM_ZERO, 0, 0 } },
+  { "-0", { 1, HM_ZERO, 0, 0 } },
+  { "+subnormal", { 0, HM_SUBNORMAL, 0, 0 } },
+  { "-subnormal", { 1, HM_SUBNORMAL, 0, 0 } },
+};
+
+#define SP_NCLASSES ((int) (sizeof (sp_classes) / sizeof (sp_classes[0])))
+
+/* the (first) result of the function on randoms[0..DIST_ARITY-1] */
+static TYPE_UNDER_TEST
+sp_eval (TYPE_UNDER_TEST *randoms,
+         function_type_under_test *p_function_under_test)
+{
+  TYPE_UNDER_TEST accu = 0;
+  CALL_LATENCY(accu, 0);
+  return accu;
+}
+
+/* Fill randoms with count inputs whose result is subnormal, each argument
+   being taken from the normal inputs, a random binade or the subnormals.
+   Return 0 if none is found. */
+static int
+sp_subnormal_results (TYPE_UNDER_TEST *randoms, const TYPE_UNDER_TEST *normal,
+                      int count,
+                      function_type_under_test *p_function_under_test)
+{
+  int found = 0;
+  for (long t = 0; t < SP_SEARCH && found < count; t++)
+    {
+      TYPE_UNDER_TEST *x = randoms + found * DIST_ARITY;
+      for (unsigned k = 0; k < DIST_ARITY; k++)
+        {
+          /* the binades around 1 half of the time, where the arguments
+             leading to subnormal results usually are (exp, pow) */
+          int e = (rand () & 1) ? HM_EMIN + rand () % (HM_EMAX - HM_EMIN)
+            : rand () % 64 - 32;
+          hm_class_t c = { rand () & 1, HM_BINADE, e, e + 1 };
+          switch (rand () % 3)
+            {
+            case 0:
+              x[k] = normal[(rand () % count) * DIST_ARITY + k];
+              break;
+            case 1:
+              x[k] = hm_sample (&c);
+              break;
+            default:
+              c.kind = HM_SUBNORMAL;
+              x[k] = hm_sample (&c);
+            }
+        }
+      if (fpclassify (sp_eval (x, p_function_under_test)) == FP_SUBNORMAL)
+        found++;
+    }
+  if (found == 0)
+    return 0;
+  for (int i = found; i < count; i++)
+    for (unsigned k = 0; k < DIST_ARITY; k++)
+      randoms[i * DIST_ARITY + k] = randoms[(i % found) * DIST_ARITY + k];
+  return 1;
+}
+
+/* run the function on randoms[0..count-1] for SP_WARMUP ticks */
+static void
+sp_warmup (TYPE_UNDER_TEST *randoms, int count,
+           function_type_under_test *p_function_under_test)
+{
+  uint64_t start = __rdtsc ();
+  do
+    for (int i = 0; i < count; i++)
+      {
+        CALL_THROUGHPUT(i);
+      }
+  while (__rdtsc () - start < SP_WARMUP);
+}
+
+/* the cycles/call (minimum over the repeat passes) and the assists per
+   call counted by fd (-1 if fd < 0); some functions are compiled with
+   -ffinite-math-only, thus NaN and Inf are not used as markers */
+static void
+sp_time (double *cycles, double *assists, TYPE_UNDER_TEST *randoms,
+         int count, int repeat, int fd,
+         function_type_under_test *p_function_under_test)
+{
+  uint64_t n = 0;
+  *cycles = DBL_MAX;
+  for (int r = 0; r < repeat; r++)
+    {
+      if (fd >= 0)
+        {
+          ioctl (fd, PERF_EVENT_IOC_RESET, 0);
+          ioctl (fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+      uint64_t start = __rdtsc ();
+      for (int i = 0; i < count; i++)
+        {
+          CALL_THROUGHPUT(i);
+        }
+      double c = (double) (__rdtsc () - start) / count;
+      if (fd >= 0)
+        {
+          uint64_t v[3]; /* value, time enabled, time running */
+          ioctl (fd, PERF_EVENT_IOC_DISABLE, 0);
+          if (read (fd, v, sizeof (v)) == sizeof (v))
+            n += v[0];
+        }
+      if (c < *cycles)
+        *cycles = c;
+    }
+  *assists = (fd >= 0) ? (double) n / ((double) repeat * count) : -1;
+}
+
+static void
+sp_print (const char *name, double cycles, double normal, double assists)
+{
+  if (cycles < 0)
+    printf ("%-18s %12s %10s %16s\n", name, "n/a", "", "");
+  else if (assists < 0)
+    printf ("%-18s %12.3f %9.2fx %16s\n", name, cycles, cycles / normal,
+            "n/a");
+  else
+    printf ("%-18s %12.3f %9.2fx %16.4f\n", name, cycles, cycles / normal,
+            assists);
+}
+
+static void
+special (int count, int repeat, const dist_t *dist,
+         function_type_under_test *p_function_under_test)
+{
+  TYPE_UNDER_TEST *normal = malloc (count * SAMPLE_SIZE);
+  TYPE_UNDER_TEST *randoms = malloc (count * SAMPLE_SIZE);
+  if (normal == NULL || randoms == NULL)
+    {
+      perror ("malloc");
+      exit (3);
+    }
+  dist_fill (normal, count, dist);
+  int fd = perf_event_fd (perf_event_index ("fp-assists"), -1);
+
+  printf ("%-18s %12s %10s %16s\n", "inputs", "cycles/call", "vs normal",
+          "fp-assists/call");
+  double c, a, ref;
+  memcpy (randoms, normal, count * SAMPLE_SIZE);
+  sp_warmup (randoms, count, p_function_under_test);
+  sp_time (&ref, &a, randoms, count, repeat, fd, p_function_under_test);
+  sp_print ("normal", ref, ref, a);
+
+  for (unsigned k = 0; k < DIST_ARITY; k++)
+    for (int j = 0; j < SP_NCLASSES; j++)
+      {
+        char name[32];
+        memcpy (randoms, normal, count * SAMPLE_SIZE);
+        for (int i = 0; i < count; i++)
+          randoms[i * DIST_ARITY + k] = hm_sample (&sp_classes[j].c);
+        sp_time (&c, &a, randoms, count, repeat, fd, p_function_under_test);
+        if (DIST_ARITY == 2)
+          snprintf (name, sizeof (name), "%c=%s", "xy"[k], sp_classes[j].name);
+        else
+          snprintf (name, sizeof (name), "%s", sp_classes[j].name);
+        sp_print (name, c, ref, a);
+      }
+
+  c = a = -1;
+  if (sp_subnormal_results (randoms, normal, count, p_function_under_test))
+    sp_time (&c, &a, randoms, count, repeat, fd, p_function_under_test);
+  sp_print ("subnormal result", c, ref, a);
+
+  if (fd >= 0)
+    close (fd);
+  free (normal);
+  free (randoms);
+}
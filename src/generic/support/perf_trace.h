@@ -0,0 +1,61 @@
+/* Format of the traces of calls recorded by libcoremath_trace.so.
+
+Copyright (c) 2025 The CORE-MATH Authors.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef PERF_TRACE_H
+#define PERF_TRACE_H
+
+#include <stdint.h>
+
+/* A trace file (written by trace_preload.c, replayed by perf-mix) is a
+   header followed by a ring of trace_record_t: the record of the i-th
+   recorded call is at index i % capacity, thus once the ring is full it
+   holds the last capacity calls, the oldest one being at next % capacity.
+   Each record gives the index of the function in the names of the header,
+   and the arguments as stored in memory (float or double, in the layout
+   of the inputs of perf-mix). */
+
+#define TRACE_MAGIC "CMTRACE1"
+#define TRACE_MAX_FUNCTIONS 64
+#define TRACE_NAME_SIZE 16
+#define TRACE_ARGS_SIZE 16
+
+typedef struct {
+  char magic[8];
+  uint64_t capacity;  /* records in the ring */
+  uint64_t next;      /* number of records written */
+  uint64_t calls;     /* number of calls, of which 1 in rate is recorded */
+  uint32_t rate;
+  uint32_t nfunctions;
+  char names[TRACE_MAX_FUNCTIONS][TRACE_NAME_SIZE];
+} trace_header_t;
+
+typedef struct {
+  uint32_t function;
+  uint32_t reserved;
+  unsigned char args[TRACE_ARGS_SIZE];
+} trace_record_t;
+
+#endif
@@ -0,0 +1,98 @@
+/* Runtime of the phase markers (CORE_MATH_PROFILE).
+
+Copyright (c) 2025 The CORE-MATH Authors.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/* Runtime of the phase markers of profile.h: the phases are registered at
+   their first marker, under a lock, after the two phases of the perf
+   program. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "profile.h"
+
+#define MAX_PHASES CORE_MATH_PROFILE_MAX_PHASES
+#define MAX_NAME 128
+
+__thread unsigned long long __cr_profile_cycles[MAX_PHASES];
+__thread unsigned long long __cr_profile_hits[MAX_PHASES];
+__thread int __cr_profile_cur = 1;
+__thread unsigned long long __cr_profile_start;
+
+/* file and name are string literals (__FILE__ and the argument of
+   CORE_MATH_PHASE) */
+static const char *phase_file[MAX_PHASES] = { "", "" };
+static const char *phase_name[MAX_PHASES] = { "(entry)", "(outside)" };
+static char phase_full_name[MAX_PHASES][MAX_NAME] = { "(entry)",
+                                                      "(outside)" };
+static int nphases = 2;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+static const char *
+basename_of (const char *file)
+{
+  const char *s = strrchr (file, '/');
+  return (s == NULL) ? file : s + 1;
+}
+
+int
+__cr_profile_register (const char *file, const char *name)
+{
+  file = basename_of (file);
+  pthread_mutex_lock (&lock);
+  int i;
+  for (i = 2; i < nphases; i++)
+    if (strcmp (phase_file[i], file) == 0 && strcmp (phase_name[i], name) == 0)
+      break;
+  if (i == nphases)
+    {
+      if (nphases == MAX_PHASES)
+        {
+          fprintf (stderr, "Error, too many CORE_MATH_PHASE markers\n");
+          exit (1);
+        }
+      phase_file[i] = file;
+      phase_name[i] = name;
+      snprintf (phase_full_name[i], MAX_NAME, "%s:%s", file, name);
+      __atomic_store_n (&nphases, i + 1, __ATOMIC_RELEASE);
+    }
+  pthread_mutex_unlock (&lock);
+  return i;
+}
+
+int
+__cr_profile_nphases (void)
+{
+  return __atomic_load_n (&nphases, __ATOMIC_ACQUIRE);
+}
+
+const char *
+__cr_profile_name (int id)
+{
+  return phase_full_name[id];
+}
@@ -0,0 +1,107 @@
+/* Phase markers (CORE_MATH_PROFILE).
+
+Copyright (c) 2025 The CORE-MATH Authors.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/* With make CORE_MATH_PROFILE=1, this file is included in front of each
+   source file (see Makefile.checkstd), and the fast paths of some functions
+   mark the start of their phases: for example cr_exp has
+   CORE_MATH_PHASE("filter") at its entry, then CORE_MATH_PHASE("reduction"),
+   CORE_MATH_PHASE("polynomial"), CORE_MATH_PHASE("rounding test") and
+   CORE_MATH_PHASE("reconstruction"). Each marker reads the time-stamp
+   counter, and adds the cycles since the previous marker to the phase that
+   ends. The perf program (see perf_common.h) marks the phase 0, "(entry)",
+   before each call, and the phase 1, "(outside)", after it, so that the
+   last phase of a call ends when it returns, and subtracts the cost of
+   the markers, calibrated on an empty function. On x86, each marker reads the counter between
+   two lfence instructions, so that the instructions before it have
+   completed, and the ones after it have not started (isb on aarch64). The
+   compiler may still move computations without memory accesses across a
+   marker. Since the phases no longer overlap as they would without
+   markers, their sum exceeds the cycles of a call without markers: the
+   breakdown tells which phase is expensive, not what would be saved by
+   removing it, and each marker slows down the function.
+   The counters are thread-local. Without CORE_MATH_PROFILE,
+   CORE_MATH_PHASE(name) expands to nothing. */
+
+#ifndef CORE_MATH_PROFILE_H
+#define CORE_MATH_PROFILE_H
+
+/* This file includes no header: it is included in front of files which
+   define _GNU_SOURCE before their first include. */
+
+#define CORE_MATH_PROFILE_MAX_PHASES 256
+
+#define CORE_MATH_PHASE(name) do {                                       \
+    static int __cr_profile_id = -1;                                     \
+    if (__cr_profile_id < 0)                                             \
+      __cr_profile_id = __cr_profile_register (__FILE__, name);          \
+    __cr_profile_mark (__cr_profile_id);                                 \
+  } while (0)
+
+/* the cycles spent in each phase, and the number of times it ended */
+extern __thread unsigned long long __cr_profile_cycles[CORE_MATH_PROFILE_MAX_PHASES];
+extern __thread unsigned long long __cr_profile_hits[CORE_MATH_PROFILE_MAX_PHASES];
+/* the current phase, and the time it started */
+extern __thread int __cr_profile_cur;
+extern __thread unsigned long long __cr_profile_start;
+
+static inline unsigned long long
+__cr_profile_clock (void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+  unsigned long long t;
+  __asm__ __volatile__ ("lfence" ::: "memory");
+  t = __builtin_ia32_rdtsc ();
+  __asm__ __volatile__ ("lfence" ::: "memory");
+  return t;
+#elif defined(__aarch64__)
+  unsigned long long t;
+  __asm__ __volatile__ ("isb; mrs %0, cntvct_el0; isb" : "=r" (t) :: "memory");
+  return t;
+#else
+  return 0;
+#endif
+}
+
+/* end the current phase, and start phase id */
+static inline void
+__cr_profile_mark (int id)
+{
+  unsigned long long t = __cr_profile_clock ();
+  __cr_profile_cycles[__cr_profile_cur] += t - __cr_profile_start;
+  __cr_profile_hits[__cr_profile_cur]++;
+  __cr_profile_cur = id;
+  __cr_profile_start = t;
+}
+
+/* the id of the phase name of file, registering it at its first call */
+int __cr_profile_register (const char *file, const char *name);
+
+/* the number of phases, and the name "file:name" of phase id */
+int __cr_profile_nphases (void);
+const char *__cr_profile_name (int id);
+
+#endif
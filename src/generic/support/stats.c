@@ -0,0 +1,187 @@
+/* Per-path hit counters (CORE_MATH_STATS).
+
+Copyright (c) 2025 The CORE-MATH Authors.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/* Runtime of the counters of stats.h. The sites are registered at their
+   first hit in a global table, under a lock. Each thread has its own array
+   of counters, allocated at its first hit and linked in a global list, so
+   that the counts of threads which have terminated (such as OpenMP workers)
+   are kept for cr_stats_dump(). */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "stats.h"
+
+/* the runtime does not count its own branches */
+#undef __builtin_expect
+
+#define MAX_SITES CORE_MATH_STATS_MAX_SITES
+#define MAX_NAME 128
+
+typedef struct counters_s {
+  uint64_t hits[MAX_SITES];
+  struct counters_s *next;
+} counters_t;
+
+/* file and path are string literals (__FILE__ and the argument of
+   CORE_MATH_STAT) */
+static const char *site_file[MAX_SITES];
+static const char *site_path[MAX_SITES];
+static char site_name[MAX_SITES][MAX_NAME];
+static int site_calls[MAX_SITES]; /* is the path "calls"? */
+static int nsites = 0;
+static counters_t *all_counters = NULL;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+static __thread counters_t *counters = NULL;
+__thread int __cr_stats_last = -1;
+
+static const char *
+basename_of (const char *file)
+{
+  const char *s = strrchr (file, '/');
+  return (s == NULL) ? file : s + 1;
+}
+
+/* the id of the site (file,path), registering it if needed; two sites
+   with the same name (say "calls" in two inlined copies) share their id */
+static int
+register_site (const char *file, const char *path)
+{
+  file = basename_of (file);
+  for (int i = 0; i < nsites; i++)
+    if (strcmp (site_file[i], file) == 0 && strcmp (site_path[i], path) == 0)
+      return i;
+  if (nsites == MAX_SITES)
+    {
+      fprintf (stderr, "Error, too many CORE_MATH_STAT sites\n");
+      exit (1);
+    }
+  site_file[nsites] = file;
+  site_path[nsites] = path;
+  snprintf (site_name[nsites], MAX_NAME, "%s:%s", file, path);
+  site_calls[nsites] = strcmp (path, "calls") == 0;
+  return nsites++;
+}
+
+void
+__cr_stats_hit (int *id, const char *file, const char *path)
+{
+  int i = __atomic_load_n (id, __ATOMIC_ACQUIRE);
+  if (__builtin_expect (i < 0 || counters == NULL, 0))
+    {
+      pthread_mutex_lock (&lock);
+      if (*id < 0)
+        __atomic_store_n (id, register_site (file, path), __ATOMIC_RELEASE);
+      i = *id;
+      if (counters == NULL)
+        {
+          counters = calloc (1, sizeof (counters_t));
+          if (counters == NULL)
+            {
+              perror ("calloc");
+              exit (3);
+            }
+          counters->next = all_counters;
+          all_counters = counters;
+        }
+      pthread_mutex_unlock (&lock);
+    }
+  counters->hits[i]++;
+  if (!site_calls[i])
+    __cr_stats_last = i;
+}
+
+int
+__cr_stats_nsites (void)
+{
+  return __atomic_load_n (&nsites, __ATOMIC_ACQUIRE);
+}
+
+const char *
+__cr_stats_name (int id)
+{
+  return (id < 0) ? "fast" : site_name[id];
+}
+
+void
+cr_stats_reset (void)
+{
+  pthread_mutex_lock (&lock);
+  for (counters_t *c = all_counters; c != NULL; c = c->next)
+    memset (c->hits, 0, sizeof (c->hits));
+  pthread_mutex_unlock (&lock);
+}
+
+/* For each file, print the number of calls, then the hits of each path with
+   their fraction of the calls. The paths of a shared kernel (say
+   exp_core.c), which has no "calls" site, are given as a fraction of all the
+   calls. */
+void
+cr_stats_dump (void)
+{
+  static uint64_t hits[MAX_SITES];
+  uint64_t total = 0;
+  pthread_mutex_lock (&lock);
+  memset (hits, 0, sizeof (hits));
+  for (counters_t *c = all_counters; c != NULL; c = c->next)
+    for (int i = 0; i < nsites; i++)
+      hits[i] += c->hits[i];
+  for (int i = 0; i < nsites; i++)
+    if (site_calls[i])
+      total += hits[i];
+  int done[MAX_SITES] = {0};
+  for (int i = 0; i < nsites; i++)
+    {
+      if (done[i])
+        continue;
+      /* the calls of the file of site i, if any */
+      int has_calls = 0;
+      uint64_t calls = total;
+      for (int j = i; j < nsites; j++)
+        if (site_calls[j] && strcmp (site_file[j], site_file[i]) == 0)
+          has_calls = 1, calls = hits[j];
+      if (has_calls)
+        printf ("%s: %lu calls\n", site_file[i], (unsigned long) calls);
+      else
+        printf ("%s: (%lu calls in all)\n", site_file[i],
+                (unsigned long) total);
+      for (int j = i; j < nsites; j++)
+        if (strcmp (site_file[j], site_file[i]) == 0)
+          {
+            done[j] = 1;
+            if (!site_calls[j])
+              printf ("  %12lu %9.5f%%  %s\n", (unsigned long) hits[j],
+                      (calls == 0) ? 0.0 : 100.0 * (double) hits[j] / calls,
+                      site_path[j]);
+          }
+    }
+  pthread_mutex_unlock (&lock);
+}
@@ -0,0 +1,84 @@
+/* Per-path hit counters (CORE_MATH_STATS).
+
+Copyright (c) 2025 The CORE-MATH Authors.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/* With make CORE_MATH_STATS=1, this file is included in front of each source
+   file (see Makefile.checkstd), and each function counts the calls of its
+   paths: CORE_MATH_STAT("calls") at the entry of cr_foo, and for example
+   CORE_MATH_STAT("as_exp_accurate") at the entry of the helpers of the
+   accurate path, of the database of hard cases, and of the special cases.
+   With CORE_MATH_STATS_EXPECT (only defined for the function and its
+   kernels, since for example gmp.h uses __builtin_expect in extern inline
+   functions), each rare branch which is taken, i.e., each
+   __builtin_expect(c,v) with c != v, is also counted, as the path
+   "line N: (c) != v" of its file: this covers the special cases and exceptions
+   handled inline, without helper.
+   A call that only hits "calls" took the fast path. The counters are
+   thread-local (the check programs use OpenMP), and cr_stats_dump() prints
+   their sum over all threads. Without CORE_MATH_STATS, CORE_MATH_STAT(path)
+   expands to nothing. */
+
+#ifndef CORE_MATH_STATS_H
+#define CORE_MATH_STATS_H
+
+#define CORE_MATH_STATS_MAX_SITES 1024
+
+#define CORE_MATH_STAT(path) do {                        \
+    static int __cr_stats_id = -1;                       \
+    __cr_stats_hit (&__cr_stats_id, __FILE__, path);     \
+  } while (0)
+
+#define __cr_stats_str(x) __cr_stats_str1(x)
+#define __cr_stats_str1(x) #x
+
+#ifdef CORE_MATH_STATS_EXPECT
+/* in the expansion, __builtin_expect is the builtin again */
+#define __builtin_expect(c, v) __extension__ ({                  \
+    long __cr_stats_c = (long) (c);                              \
+    if (!__cr_stats_c != !(v))                                   \
+      {                                                          \
+        static int __cr_stats_id = -1;                           \
+        __cr_stats_hit (&__cr_stats_id, __FILE__, "line "        \
+                        __cr_stats_str (__LINE__) ": (" #c ") != " #v);  \
+      }                                                          \
+    __builtin_expect (__cr_stats_c, (v)); })
+#endif
+
+/* count a hit of the site *id, registering it at its first hit */
+void __cr_stats_hit (int *id, const char *file, const char *path);
+
+/* the last site hit by the current thread, other than "calls", or -1 */
+extern __thread int __cr_stats_last;
+
+/* the number of sites, and the name "file:path" of site id */
+int __cr_stats_nsites (void);
+const char *__cr_stats_name (int id);
+
+/* print the counters on stdout, or set them to zero */
+void cr_stats_dump (void);
+void cr_stats_reset (void);
+
+#endif
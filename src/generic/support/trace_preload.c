@@ -0,0 +1,238 @@
+/* Record the arguments of the calls to the libm (LD_PRELOAD library).
+
+Copyright (c) 2025 The CORE-MATH Authors.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* libcoremath_trace.so (make -C src/generic/support libcoremath_trace.so)
+   interposes the functions of TRACE_FUNCTIONS when preloaded:
+
+     LD_PRELOAD=.../libcoremath_trace.so ./application
+
+   Each call is forwarded to the libm (the next definition of the symbol),
+   or with CORE_MATH_TRACE_FORWARD=cr to cr_name when the process defines
+   it (for example when linked with core-math), and 1 call in
+   CORE_MATH_TRACE_RATE (1 by default) is recorded. Each thread records
+   its calls, in order, in its own file CORE_MATH_TRACE_DIR/trace.pid.tid
+   (/tmp by default), a ring of CORE_MATH_TRACE_SIZE records (2^20 by
+   default) mapped in memory, so that recording a call costs no system
+   call (see perf_trace.h). perf-mix --trace replays such a file. */
+
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#include "perf_trace.h"
+
+/* X(name, type, kind), where kind is 1 for a univariate function, 2 for a
+   bivariate one, and 3 for a sincos-like one */
+#define TRACE_FUNCTIONS                                                 \
+  X(acos, double, 1) X(acosh, double, 1) X(asin, double, 1)             \
+  X(asinh, double, 1) X(atan, double, 1) X(atanh, double, 1)            \
+  X(cbrt, double, 1) X(cos, double, 1) X(cosh, double, 1)               \
+  X(erf, double, 1) X(erfc, double, 1) X(exp, double, 1)                \
+  X(exp10, double, 1) X(exp2, double, 1) X(expm1, double, 1)            \
+  X(log, double, 1) X(log10, double, 1) X(log1p, double, 1)             \
+  X(log2, double, 1) X(sin, double, 1) X(sinh, double, 1)               \
+  X(tan, double, 1) X(tanh, double, 1) X(tgamma, double, 1)             \
+  X(atan2, double, 2) X(hypot, double, 2) X(pow, double, 2)             \
+  X(sincos, double, 3)                                                  \
+  X(acosf, float, 1) X(acoshf, float, 1) X(asinf, float, 1)             \
+  X(asinhf, float, 1) X(atanf, float, 1) X(atanhf, float, 1)            \
+  X(cbrtf, float, 1) X(cosf, float, 1) X(coshf, float, 1)               \
+  X(erff, float, 1) X(erfcf, float, 1) X(expf, float, 1)                \
+  X(exp10f, float, 1) X(exp2f, float, 1) X(expm1f, float, 1)            \
+  X(lgammaf, float, 1) X(logf, float, 1) X(log10f, float, 1)            \
+  X(log1pf, float, 1) X(log2f, float, 1) X(sinf, float, 1)              \
+  X(sinhf, float, 1) X(tanf, float, 1) X(tanhf, float, 1)               \
+  X(tgammaf, float, 1)                                                  \
+  X(atan2f, float, 2) X(hypotf, float, 2) X(powf, float, 2)             \
+  X(sincosf, float, 3)
+
+enum {
+#define X(name, type, kind) TRACE_ ## name,
+  TRACE_FUNCTIONS
+#undef X
+  TRACE_NFUNCTIONS
+};
+
+_Static_assert (TRACE_NFUNCTIONS <= TRACE_MAX_FUNCTIONS,
+                "TRACE_MAX_FUNCTIONS is too small");
+
+static const char trace_names[][TRACE_NAME_SIZE] = {
+#define X(name, type, kind) #name,
+  TRACE_FUNCTIONS
+#undef X
+};
+
+static pthread_once_t trace_once = PTHREAD_ONCE_INIT;
+static uint64_t trace_rate = 1, trace_capacity = 1 << 20;
+static const char *trace_dir = "/tmp";
+static int trace_forward_cr = 0;
+
+typedef struct {
+  trace_header_t *header; /* NULL until the first call */
+  trace_record_t *ring;
+  size_t size;            /* of the mapping */
+  int failed;
+} trace_thread_t;
+
+static __thread trace_thread_t trace_thread;
+
+/* the child of a fork starts its own trace (with the same tid for the
+   thread calling fork, but another pid) */
+static void
+trace_atfork_child (void)
+{
+  if (trace_thread.header != NULL)
+    munmap (trace_thread.header, trace_thread.size);
+  memset (&trace_thread, 0, sizeof (trace_thread));
+}
+
+static void
+trace_init (void)
+{
+  const char *s;
+  if ((s = getenv ("CORE_MATH_TRACE_RATE")) != NULL && atoll (s) > 0)
+    trace_rate = atoll (s);
+  if ((s = getenv ("CORE_MATH_TRACE_SIZE")) != NULL && atoll (s) > 0)
+    trace_capacity = atoll (s);
+  if ((s = getenv ("CORE_MATH_TRACE_DIR")) != NULL && *s != '\0')
+    trace_dir = s;
+  if ((s = getenv ("CORE_MATH_TRACE_FORWARD")) != NULL)
+    trace_forward_cr = strcmp (s, "cr") == 0;
+  pthread_atfork (NULL, NULL, trace_atfork_child);
+}
+
+/* the function called for name: cr_name, or the next name */
+static void *
+trace_resolve (const char *name)
+{
+  pthread_once (&trace_once, trace_init);
+  void *f = NULL;
+  if (trace_forward_cr)
+    {
+      char cr[TRACE_NAME_SIZE + 3];
+      snprintf (cr, sizeof (cr), "cr_%s", name);
+      f = dlsym (RTLD_DEFAULT, cr);
+    }
+  if (f == NULL)
+    f = dlsym (RTLD_NEXT, name);
+  if (f == NULL)
+    {
+      fprintf (stderr, "libcoremath_trace.so: %s not found\n", name);
+      abort ();
+    }
+  return f;
+}
+
+/* create the trace file of the calling thread */
+static void
+trace_open (trace_thread_t *t)
+{
+  char path[4096];
+  snprintf (path, sizeof (path), "%s/trace.%d.%ld", trace_dir,
+            (int) getpid (), (long) syscall (SYS_gettid));
+  t->size = sizeof (trace_header_t) + trace_capacity * sizeof (trace_record_t);
+  int fd = open (path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  void *p = MAP_FAILED;
+  if (fd >= 0 && ftruncate (fd, t->size) == 0)
+    p = mmap (NULL, t->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (fd >= 0)
+    close (fd);
+  if (p == MAP_FAILED)
+    {
+      perror (path);
+      t->failed = 1;
+      return;
+    }
+  t->header = p;
+  t->ring = (trace_record_t *) (t->header + 1);
+  memcpy (t->header->magic, TRACE_MAGIC, sizeof (t->header->magic));
+  t->header->capacity = trace_capacity;
+  t->header->rate = trace_rate;
+  t->header->nfunctions = TRACE_NFUNCTIONS;
+  memcpy (t->header->names, trace_names, sizeof (trace_names));
+}
+
+static inline void
+trace_record (int function, const void *args, size_t size)
+{
+  trace_thread_t *t = &trace_thread;
+  if (__builtin_expect (t->header == NULL, 0))
+    {
+      if (t->failed)
+        return;
+      trace_open (t);
+      if (t->failed)
+        return;
+    }
+  uint64_t n = t->header->calls++;
+  if (trace_rate > 1 && n % trace_rate != 0)
+    return;
+  trace_record_t *r = &t->ring[t->header->next++ % t->header->capacity];
+  r->function = function;
+  memcpy (r->args, args, size);
+}
+
+#define TRACE_DEFINE_1(name, type)                                      \
+  type name (type x)                                                    \
+  {                                                                     \
+    static type (*f) (type);                                            \
+    if (__builtin_expect (f == NULL, 0))                                \
+      f = (type (*) (type)) trace_resolve (#name);                      \
+    trace_record (TRACE_ ## name, &x, sizeof (x));                      \
+    return f (x);                                                       \
+  }
+
+#define TRACE_DEFINE_2(name, type)                                      \
+  type name (type x, type y)                                            \
+  {                                                                     \
+    static type (*f) (type, type);                                      \
+    if (__builtin_expect (f == NULL, 0))                                \
+      f = (type (*) (type, type)) trace_resolve (#name);                \
+    type args[2] = { x, y };                                            \
+    trace_record (TRACE_ ## name, args, sizeof (args));                 \
+    return f (x, y);                                                    \
+  }
+
+#define TRACE_DEFINE_3(name, type)                                      \
+  void name (type x, type *s, type *c)                                  \
+  {                                                                     \
+    static void (*f) (type, type *, type *);                            \
+    if (__builtin_expect (f == NULL, 0))                                \
+      f = (void (*) (type, type *, type *)) trace_resolve (#name);      \
+    trace_record (TRACE_ ## name, &x, sizeof (x));                      \
+    f (x, s, c);                                                        \
+  }
+
+#define X(name, type, kind) TRACE_DEFINE_ ## kind (name, type)
+TRACE_FUNCTIONS
+#undef X
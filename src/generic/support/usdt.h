@@ -0,0 +1,123 @@
+/* USDT probes at the entry of the slow paths (CORE_MATH_USDT).
+
+Copyright (c) 2025 The CORE-MATH Authors.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* With make CORE_MATH_USDT=1, this file is included in front of each source
+   file (see Makefile.checkstd), and each site CORE_MATH_STAT(path) other
+   than "calls" (see stats.h), i.e., the entry of the helpers of the
+   accurate paths, of the databases of hard cases and of the special cases,
+   becomes the static tracepoint (USDT, see sys/sdt.h of systemtap)
+   core_math:path, with the arguments:
+     arg0: the name of the function called, for example "cr_exp"
+     arg1: the name of the path, for example "as_exp_accurate"
+     arg2: the size in bytes of each input (4 or 8)
+     arg3: the number of inputs (1 or 2)
+     arg4, arg5: the bits of the inputs, 0 for a missing one
+   The inputs are those of the call, saved at the entry of cr_foo by
+   CORE_MATH_ARGS(x) or CORE_MATH_ARGS(y, x). When no tracer is attached,
+   a tracepoint is a nop, and the inputs are not even saved: each call only
+   reads the semaphore of the probe, which the tracers increment when they
+   attach (perf does so from Linux 4.20). For the tracers which ignore the
+   semaphores, with make CORE_MATH_USDT=always (CORE_MATH_USDT_ALWAYS) the
+   probes have none, and the inputs are saved at each call. Such a build can
+   run in production, with for example:
+     bpftrace -p PID -e 'usdt:/path/to/libcoremath.so:core_math:path {
+       printf("%s %s %d %d 0x%lx 0x%lx\n", str(arg0), str(arg1),
+              arg2, arg3, arg4, arg5); }'
+   and usdt-record.sh turns the samples into .wc files. CORE_MATH_USDT and
+   CORE_MATH_STATS cannot be combined, since both define CORE_MATH_STAT. */
+
+#ifndef CORE_MATH_USDT_H
+#define CORE_MATH_USDT_H
+
+#ifdef CORE_MATH_STATS_H
+#error "CORE_MATH_USDT and CORE_MATH_STATS cannot be combined"
+#endif
+
+#ifndef CORE_MATH_USDT_ALWAYS
+#define _SDT_HAS_SEMAPHORES 1
+#endif
+#include <sys/sdt.h>
+#include <stdint.h>
+
+/* The semaphore of core_math:path, and the inputs of the current call of
+   each thread. They are defined in each file, as weak symbols merged by the
+   linker, so that no extra object is needed; hidden, since the tracers
+   increment the semaphore of the object they attach to. */
+#ifdef CORE_MATH_USDT_ALWAYS
+#define __cr_usdt_enabled() 1
+#else
+__attribute__ ((weak, visibility ("hidden"), section (".probes")))
+volatile unsigned short core_math_path_semaphore;
+
+#define __cr_usdt_enabled() __builtin_expect (core_math_path_semaphore, 0)
+#endif
+
+typedef struct {
+  const char *function;
+  uint64_t size, arity, bits[2];
+} __cr_usdt_call_t;
+
+__attribute__ ((weak, visibility ("hidden")))
+__thread __cr_usdt_call_t __cr_usdt_call;
+
+/* the bits of x, in the low part of a uint64_t */
+#define __cr_usdt_bits(x) __extension__ ({                       \
+      __typeof__ (x) __cr_usdt_x = (x);                          \
+      uint64_t __cr_usdt_u = 0;                                  \
+      __builtin_memcpy (&__cr_usdt_u, &__cr_usdt_x, sizeof (x)); \
+      __cr_usdt_u; })
+
+/* the first and second arguments, 0 if missing, and their number */
+#define __cr_usdt_first(...) __cr_usdt_first1 (__VA_ARGS__, 0)
+#define __cr_usdt_first1(a, ...) a
+#define __cr_usdt_second(...) __cr_usdt_second1 (__VA_ARGS__, 0, 0)
+#define __cr_usdt_second1(a, b, ...) b
+#define __cr_usdt_arity(...) __cr_usdt_arity1 (__VA_ARGS__, 2, 1, 0)
+#define __cr_usdt_arity1(a, b, n, ...) n
+
+#define CORE_MATH_ARGS(...) do {                                          \
+    if (__cr_usdt_enabled ())                                             \
+      {                                                                   \
+        __cr_usdt_call.function = __func__;                               \
+        __cr_usdt_call.size = sizeof (__cr_usdt_first (__VA_ARGS__));     \
+        __cr_usdt_call.arity = __cr_usdt_arity (__VA_ARGS__);             \
+        __cr_usdt_call.bits[0] =                                          \
+          __cr_usdt_bits (__cr_usdt_first (__VA_ARGS__));                 \
+        __cr_usdt_call.bits[1] =                                          \
+          __cr_usdt_bits (__cr_usdt_second (__VA_ARGS__));                \
+      }                                                                   \
+  } while (0)
+
+/* the site "calls" is the entry of cr_foo, where CORE_MATH_ARGS follows */
+#define CORE_MATH_STAT(p) do {                                            \
+    if (__builtin_strcmp (p, "calls") != 0 && __cr_usdt_enabled ())       \
+      STAP_PROBE6 (core_math, path, __cr_usdt_call.function,              \
+                   (const char *) (p), __cr_usdt_call.size,               \
+                   __cr_usdt_call.arity, __cr_usdt_call.bits[0],          \
+                   __cr_usdt_call.bits[1]);                               \
+  } while (0)
+
+#endif
@@ -0,0 +1,235 @@
+/* Aggregate the samples of the USDT probes into .wc files.
+
+Copyright (c) 2025 The CORE-MATH Authors.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* Usage: usdt_wc [--all] [--dir dir] [samples...]
+
+   Each line of the samples (the files given, or the standard input) is
+   one hit of the probe core_math:path (see usdt.h), as printed by
+   usdt-record.sh:
+     function path size arity bits0 bits1
+   for example "cr_exp as_exp_accurate 8 1 0x40862e42fefa39ef 0x0". Only
+   the accurate paths and the databases of hard cases (the paths whose name
+   contains "accurate" or "database") are kept, or all paths with --all.
+   For each function cr_foo, the distinct inputs are written to
+   dir/foo.wc (dir is . by default), in the format of the .wc files, the
+   most frequent first, after comments giving the number of samples of each
+   path. Such a file can be given to perf with --dist file:dir/foo.wc. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef struct {
+  char function[64], path[64];
+  int size, arity;
+  uint64_t bits[2];
+  long count; /* of the distinct inputs, after the aggregation */
+} sample_t;
+
+static sample_t *samples;
+static long nsamples, size;
+
+static void
+read_samples (FILE *f, const char *name, int all)
+{
+  char line[1024];
+  long lineno = 0;
+  while (fgets (line, sizeof (line), f) != NULL)
+    {
+      sample_t s;
+      lineno++;
+      if (line[0] == '#' || line[0] == '\n')
+        continue;
+      if (sscanf (line, "%63s %63s %d %d %lx %lx", s.function, s.path,
+                  &s.size, &s.arity, &s.bits[0], &s.bits[1]) != 6
+          || (s.size != 4 && s.size != 8) || s.arity < 1 || s.arity > 2)
+        {
+          fprintf (stderr, "%s:%ld: ignored\n", name, lineno);
+          continue;
+        }
+      if (!all && strstr (s.path, "accurate") == NULL
+          && strstr (s.path, "database") == NULL)
+        continue;
+      if (nsamples == size)
+        {
+          size = 2 * size + 1024;
+          samples = realloc (samples, size * sizeof (sample_t));
+          if (samples == NULL)
+            {
+              perror ("realloc");
+              exit (2);
+            }
+        }
+      samples[nsamples++] = s;
+    }
+}
+
+/* by function, then path */
+static int
+cmp_path (const void *a, const void *b)
+{
+  const sample_t *x = a, *y = b;
+  int c = strcmp (x->function, y->function);
+  return c ? c : strcmp (x->path, y->path);
+}
+
+/* by function, then input */
+static int
+cmp_input (const void *a, const void *b)
+{
+  const sample_t *x = a, *y = b;
+  int c = strcmp (x->function, y->function);
+  if (c)
+    return c;
+  for (int k = 0; k < 2; k++)
+    if (x->bits[k] != y->bits[k])
+      return (x->bits[k] > y->bits[k]) ? 1 : -1;
+  return 0;
+}
+
+/* by decreasing count, then input */
+static int
+cmp_count (const void *a, const void *b)
+{
+  const sample_t *x = a, *y = b;
+  if (x->count != y->count)
+    return (x->count < y->count) ? 1 : -1;
+  return cmp_input (a, b);
+}
+
+static void
+print_input (FILE *f, const sample_t *s)
+{
+  for (int k = 0; k < s->arity; k++)
+    {
+      double x;
+      if (s->size == 4)
+        {
+          uint32_t u = s->bits[k];
+          float v;
+          memcpy (&v, &u, sizeof (v));
+          x = v;
+        }
+      else
+        memcpy (&x, &s->bits[k], sizeof (x));
+      fprintf (f, (k == 0) ? "%a" : ",%a", x);
+    }
+  fprintf (f, "\n");
+}
+
+int
+main (int argc, char *argv[])
+{
+  const char *dir = ".";
+  int all = 0;
+
+  while (argc >= 2 && strncmp (argv[1], "--", 2) == 0)
+    {
+      if (strcmp (argv[1], "--all") == 0)
+        {
+          all = 1;
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--dir") == 0 && argc >= 3)
+        {
+          dir = argv[2];
+          argc -= 2;
+          argv += 2;
+        }
+      else
+        {
+          fprintf (stderr, "Error, unknown option %s\n", argv[1]);
+          exit (2);
+        }
+    }
+  if (argc == 1)
+    read_samples (stdin, "stdin", all);
+  for (int i = 1; i < argc; i++)
+    {
+      FILE *f = fopen (argv[i], "r");
+      if (f == NULL)
+        {
+          perror (argv[i]);
+          exit (2);
+        }
+      read_samples (f, argv[i], all);
+      fclose (f);
+    }
+
+  qsort (samples, nsamples, sizeof (sample_t), cmp_path);
+  for (long i = 0; i < nsamples;)
+    {
+      /* samples[i..j-1] are those of one function */
+      long j = i;
+      while (j < nsamples
+             && strcmp (samples[j].function, samples[i].function) == 0)
+        j++;
+      const char *name = samples[i].function;
+      if (strncmp (name, "cr_", 3) == 0)
+        name += 3;
+      char path[1024];
+      snprintf (path, sizeof (path), "%s/%s.wc", dir, name);
+      FILE *f = fopen (path, "w");
+      if (f == NULL)
+        {
+          perror (path);
+          exit (2);
+        }
+      fprintf (f, "# %ld samples of %s from the USDT probes (usdt-record.sh)\n",
+               j - i, samples[i].function);
+      for (long k = i; k < j;)
+        {
+          long l = k;
+          while (l < j && strcmp (samples[l].path, samples[k].path) == 0)
+            l++;
+          fprintf (f, "# %s: %ld\n", samples[k].path, l - k);
+          k = l;
+        }
+
+      /* the distinct inputs, with their number of samples */
+      qsort (samples + i, j - i, sizeof (sample_t), cmp_input);
+      long n = i;
+      for (long k = i; k < j; k++)
+        if (n > i && cmp_input (&samples[n - 1], &samples[k]) == 0)
+          samples[n - 1].count++;
+        else
+          {
+            samples[n] = samples[k];
+            samples[n++].count = 1;
+          }
+      qsort (samples + i, n - i, sizeof (sample_t), cmp_count);
+      fprintf (f, "# %ld distinct inputs, the most frequent first\n", n - i);
+      for (long k = i; k < n; k++)
+        print_input (f, &samples[k]);
+      fclose (f);
+      printf ("%s: %ld samples, %ld inputs\n", path, j - i, n - i);
+      i = j;
+    }
+  free (samples);
+  return 0;
+}
@@ -0,0 +1,80 @@
+#!/bin/bash
+# Usage:
+# ./usdt-record.sh -p PID [--duration S] [--all] [--dir DIR] [object]
+# ./usdt-record.sh -c "command args" [--all] [--dir DIR] [object]
+# ./usdt-record.sh --samples FILE [--all] [--dir DIR]
+#
+# Record the inputs which take the slow paths of core-math in a running
+# process (-p, until Ctrl-C or for S seconds) or in a command (-c), then
+# write them to DIR/foo.wc for each function cr_foo (DIR is usdt-wc by
+# default), the most frequent first, for perf --dist file:DIR/foo.wc.
+# core-math must be built with CORE_MATH_USDT=1 (see
+# src/generic/support/usdt.h), which turns the entry of each accurate path
+# and database of hard cases into the static tracepoint core_math:path;
+# object is the executable or library with these tracepoints (by default
+# the executable of the process or of the command). The samples are
+# recorded with bpftrace, and aggregated by src/generic/support/usdt_wc
+# (--all keeps the special cases too); --samples aggregates samples
+# recorded otherwise, one per line:
+#   function path size arity bits0 bits1
+# for example converted from the output of perf script, after perf probe
+# sdt_core_math:path and perf record -e sdt_core_math:path.
+
+set -e
+
+pid=""
+cmd=""
+samples=""
+duration=""
+all=""
+dir=usdt-wc
+while [ $# -gt 0 ]; do
+    case "$1" in
+        -p) pid="$2"; shift 2 ;;
+        -c) cmd="$2"; shift 2 ;;
+        --samples) samples="$2"; shift 2 ;;
+        --duration) duration="$2"; shift 2 ;;
+        --all) all=--all; shift ;;
+        --dir) dir="$2"; shift 2 ;;
+        -*) echo "Unknown option: $1" >&2; exit 2 ;;
+        *) break ;;
+    esac
+done
+object="$1"
+
+make -s -C src/generic/support usdt_wc
+mkdir -p "$dir"
+
+if [ -n "$samples" ]; then
+    src/generic/support/usdt_wc $all --dir "$dir" "$samples"
+    exit 0
+fi
+
+if [ -n "$pid" ]; then
+    target="-p $pid"
+    [ -n "$object" ] || object="$(readlink -f /proc/$pid/exe)"
+elif [ -n "$cmd" ]; then
+    target="-c"
+    [ -n "$object" ] || object="$(readlink -f "$(command -v ${cmd%% *})")"
+else
+    echo "Usage: $0 -p PID | -c command | --samples file" >&2
+    exit 2
+fi
+
+SAMPLES_FILE="$(mktemp /tmp/core-math.XXXXXX)"
+trap "rm -f $SAMPLES_FILE" 0
+
+# bpftrace increments the semaphore of the tracepoint while it is attached
+prog='usdt:'"$object"':core_math:path {
+  printf("%s %s %d %d 0x%lx 0x%lx\n", str(arg0), str(arg1), arg2, arg3,
+         arg4, arg5); }'
+if [ -n "$pid" ]; then
+    # Ctrl-C stops bpftrace, not this script
+    trap true INT
+    ${duration:+timeout -s INT $duration} bpftrace -q -p $pid -e "$prog" \
+        > $SAMPLES_FILE || true
+    trap - INT
+else
+    bpftrace -q -c "$cmd" -e "$prog" > $SAMPLES_FILE
+fi
+src/generic/support/usdt_wc $all --dir "$dir" $SAMPLES_FILE